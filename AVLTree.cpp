@@ -1,8 +1,11 @@
 #include "AVLTree.h"
+#include "Logger.h"
 #include <iostream>
 #include <iomanip>
 #include <cstdlib>
+#include <cstring>
 #include <algorithm>
+#include <type_traits>
 
 using namespace std;
 
@@ -18,24 +21,27 @@ const string BOLD = "\033[1m";
 AVLTree::AVLTree()
 {
     root = NULL;
-    cout << GREEN << "[SUCCESS] Flight Log system initialized" << RESET << endl;
+    LOG_INFO << GREEN << "[SUCCESS] Flight Log system initialized" << RESET;
 }
 
-// ========== DESTRUCTOR ==========
-AVLTree::~AVLTree()
+// Nodes are released chunk by chunk without running destructors
+static_assert(is_trivially_destructible<AVLNode>::value, "AVLNode must stay plain data");
+
+// ========== FLIGHT LOG ==========
+FlightLog::FlightLog(FlightHandle id, const string &org, const string &dest,
+                     const string &time, const string &res)
+    : flightID(id), origin(airportNames().intern(org)), destination(airportNames().intern(dest)),
+      result(parseAircraftStatus(res))
 {
-    deleteTree(root);
+    size_t length = time.copy(arrivalTime, LOG_TIME_LENGTH);
+    arrivalTime[length] = '\0';
 }
 
-// ========== DELETE ENTIRE TREE ==========
-void AVLTree::deleteTree(AVLNode *node)
+// ========== DESTRUCTOR ==========
+AVLTree::~AVLTree()
 {
-    if (node == NULL)
-        return;
-
-    deleteTree(node->left);
-    deleteTree(node->right);
-    delete node;
+    // The pool frees every node at once
+    root = NULL;
 }
 
 // ========== GET HEIGHT OF NODE ==========
@@ -89,20 +95,21 @@ AVLNode *AVLTree::rotateLeft(AVLNode *x)
 }
 
 // ========== INSERT NODE RECURSIVELY ==========
-AVLNode *AVLTree::insertNode(AVLNode *node, FlightLog log)
+AVLNode *AVLTree::insertNode(AVLNode *node, const FlightLog &log)
 {
     // Base case: create new node
     if (node == NULL)
     {
-        return new AVLNode(log);
+        return nodePool.create(log);
     }
 
     // Insert based on timestamp comparison
-    if (log.arrivalTime < node->logData.arrivalTime)
+    int order = strcmp(log.arrivalTime, node->logData.arrivalTime);
+    if (order < 0)
     {
         node->left = insertNode(node->left, log);
     }
-    else if (log.arrivalTime > node->logData.arrivalTime)
+    else if (order > 0)
     {
         node->right = insertNode(node->right, log);
     }
@@ -119,26 +126,26 @@ AVLNode *AVLTree::insertNode(AVLNode *node, FlightLog log)
     int balance = getBalance(node);
 
     // LL Case (Left-Left)
-    if (balance > 1 && log.arrivalTime < node->left->logData.arrivalTime)
+    if (balance > 1 && strcmp(log.arrivalTime, node->left->logData.arrivalTime) < 0)
     {
         return rotateRight(node);
     }
 
     // RR Case (Right-Right)
-    if (balance < -1 && log.arrivalTime > node->right->logData.arrivalTime)
+    if (balance < -1 && strcmp(log.arrivalTime, node->right->logData.arrivalTime) > 0)
     {
         return rotateLeft(node);
     }
 
     // LR Case (Left-Right)
-    if (balance > 1 && log.arrivalTime > node->left->logData.arrivalTime)
+    if (balance > 1 && strcmp(log.arrivalTime, node->left->logData.arrivalTime) > 0)
     {
         node->left = rotateLeft(node->left);
         return rotateRight(node);
     }
 
     // RL Case (Right-Left)
-    if (balance < -1 && log.arrivalTime < node->right->logData.arrivalTime)
+    if (balance < -1 && strcmp(log.arrivalTime, node->right->logData.arrivalTime) < 0)
     {
         node->right = rotateRight(node->right);
         return rotateLeft(node);
@@ -162,7 +169,7 @@ AVLNode *AVLTree::findMin(AVLNode *node)
 }
 
 // ========== DELETE NODE RECURSIVELY ==========
-AVLNode *AVLTree::deleteNode(AVLNode *node, string flightID)
+AVLNode *AVLTree::deleteNode(AVLNode *node, FlightHandle flightID)
 {
     if (node == NULL)
         return NULL;
@@ -183,7 +190,7 @@ AVLNode *AVLTree::deleteNode(AVLNode *node, string flightID)
         // Case 1: Node has no children (leaf)
         if (node->left == NULL && node->right == NULL)
         {
-            delete node;
+            nodePool.destroy(node);
             return NULL;
         }
 
@@ -191,14 +198,14 @@ AVLNode *AVLTree::deleteNode(AVLNode *node, string flightID)
         if (node->left == NULL)
         {
             AVLNode *temp = node->right;
-            delete node;
+            nodePool.destroy(node);
             return temp;
         }
 
         if (node->right == NULL)
         {
             AVLNode *temp = node->left;
-            delete node;
+            nodePool.destroy(node);
             return temp;
         }
 
@@ -247,7 +254,7 @@ AVLNode *AVLTree::deleteNode(AVLNode *node, string flightID)
 }
 
 // ========== SEARCH NODE ==========
-AVLNode *AVLTree::searchNode(AVLNode *node, string flightID)
+AVLNode *AVLTree::searchNode(AVLNode *node, FlightHandle flightID)
 {
     if (node == NULL)
         return NULL;
@@ -277,18 +284,19 @@ void AVLTree::inOrderTraversal(AVLNode *node)
     // Print current node
     cout << BOLD << "  +------------------------------------------+\n"
          << RESET;
-    cout << "  | " << CYAN << "Flight ID: " << RESET << node->logData.flightID << endl;
-    cout << "  | " << CYAN << "Origin: " << RESET << node->logData.origin << endl;
-    cout << "  | " << CYAN << "Destination: " << RESET << node->logData.destination << endl;
+    cout << "  | " << CYAN << "Flight ID: " << RESET << flightIDs().getName(node->logData.flightID) << endl;
+    cout << "  | " << CYAN << "Origin: " << RESET << airportNames().getName(node->logData.origin) << endl;
+    cout << "  | " << CYAN << "Destination: " << RESET << airportNames().getName(node->logData.destination) << endl;
     cout << "  | " << CYAN << "Arrival Time: " << RESET << node->logData.arrivalTime << endl;
 
-    if (node->logData.result == "LANDED")
+    const string &result = aircraftStatusName(node->logData.result);
+    if (node->logData.result == AIRCRAFT_LANDED)
     {
-        cout << "  | " << CYAN << "Result: " << RESET << GREEN << node->logData.result << RESET << endl;
+        cout << "  | " << CYAN << "Result: " << RESET << GREEN << result << RESET << endl;
     }
     else
     {
-        cout << "  | " << CYAN << "Result: " << RESET << RED << node->logData.result << RESET << endl;
+        cout << "  | " << CYAN << "Result: " << RESET << RED << result << RESET << endl;
     }
 
     cout << BOLD << "  +------------------------------------------+\n"
@@ -299,52 +307,60 @@ void AVLTree::inOrderTraversal(AVLNode *node)
 }
 
 // ========== INSERT LOG ==========
-void AVLTree::insertLog(string flightID, string origin, string destination,
-                        string time, string result)
+void AVLTree::insertLog(const string &flightID, const string &origin, const string &destination,
+                        const string &time, const string &result)
 {
+    if (time.size() > (size_t)LOG_TIME_LENGTH)
+    {
+        LOG_WARNING << YELLOW << "[WARNING]" << RESET << " Arrival time \"" << time
+                    << "\" cut to " << LOG_TIME_LENGTH << " characters";
+    }
 
-    FlightLog newLog(flightID, origin, destination, time, result);
+    FlightLog newLog(flightIDs().intern(flightID), origin, destination, time, result);
     root = insertNode(root, newLog);
 
-    cout << GREEN << "[LOG]" << RESET << " Flight " << CYAN << flightID
-         << RESET << " recorded - " << result << endl;
+    LOG_INFO << GREEN << "[LOG]" << RESET << " Flight " << CYAN << flightID
+             << RESET << " recorded - " << result;
 }
 
 // ========== DELETE LOG ==========
-bool AVLTree::deleteLog(string flightID)
+bool AVLTree::deleteLog(const string &flightID)
 {
-    AVLNode *node = searchNode(root, flightID);
+    FlightHandle handle = flightIDs().lookup(flightID);
+    AVLNode *node = searchNode(root, handle);
 
     if (node == NULL)
     {
-        cout << RED << "[ERROR]" << RESET << " Flight log not found" << endl;
+        LOG_ERROR << RED << "[ERROR]" << RESET << " Flight log not found";
         return false;
     }
 
-    root = deleteNode(root, flightID);
+    root = deleteNode(root, handle);
 
-    cout << GREEN << "[DELETE]" << RESET << " Flight log deleted" << endl;
+    LOG_INFO << GREEN << "[DELETE]" << RESET << " Flight log deleted";
     return true;
 }
 
 // ========== SEARCH LOG ==========
-FlightLog *AVLTree::searchLog(string flightID)
+FlightLog *AVLTree::searchLog(const string &flightID)
 {
-    AVLNode *node = searchNode(root, flightID);
+    AVLNode *node = searchNode(root, flightIDs().lookup(flightID));
 
     if (node == NULL)
     {
-        cout << RED << "[NOT FOUND]" << RESET << " Flight log not found" << endl;
+        LOG_INFO << RED << "[NOT FOUND]" << RESET << " Flight log not found";
         return NULL;
     }
 
-    cout << GREEN << "[FOUND]" << RESET << " Flight log located" << endl;
+    LOG_INFO << GREEN << "[FOUND]" << RESET << " Flight log located";
     return &(node->logData);
 }
 
 // ========== PRINT ALL LOGS ==========
 void AVLTree::printAllLogs()
 {
+    logger().flush();
+
     cout << BOLD << CYAN;
     cout << "\n+=============================================================+\n";
     cout << "|              " << YELLOW << "FLIGHT LOG HISTORY (CHRONOLOGICAL)" << CYAN << "        |\n";
@@ -373,4 +389,86 @@ int AVLTree::getTreeHeight()
 bool AVLTree::isEmpty()
 {
     return root == NULL;
-}
\ No newline at end of file
+}
+
+// ========== COUNT NODES ==========
+int AVLTree::countNodes(AVLNode *node)
+{
+    if (node == NULL)
+        return 0;
+    return 1 + countNodes(node->left) + countNodes(node->right);
+}
+
+// ========== SAVE LOGS IN ORDER ==========
+void AVLTree::saveInOrder(AVLNode *node, BinaryWriter &out)
+{
+    if (node == NULL)
+        return;
+
+    saveInOrder(node->left, out);
+
+    out.writeU32(node->logData.flightID);
+    out.writeString(airportNames().getName(node->logData.origin));
+    out.writeString(airportNames().getName(node->logData.destination));
+    out.writeString(node->logData.arrivalTime);
+    out.writeString(aircraftStatusName(node->logData.result));
+
+    saveInOrder(node->right, out);
+}
+
+// ========== BUILD BALANCED TREE FROM SORTED LOGS ==========
+AVLNode *AVLTree::buildBalanced(FlightLog *logs, int first, int last)
+{
+    if (first > last)
+        return NULL;
+
+    // Middle element becomes the root, so sibling heights differ by at most 1
+    int mid = first + (last - first) / 2;
+    AVLNode *node = nodePool.create(logs[mid]);
+    node->left = buildBalanced(logs, first, mid - 1);
+    node->right = buildBalanced(logs, mid + 1, last);
+    node->height = 1 + max(getHeight(node->left), getHeight(node->right));
+
+    return node;
+}
+
+// ========== SAVE BINARY SECTION ==========
+void AVLTree::saveBinary(BinaryWriter &out)
+{
+    out.writeI32(countNodes(root));
+    saveInOrder(root, out);
+}
+
+// ========== LOAD BINARY SECTION ==========
+bool AVLTree::loadBinary(BinaryReader &in, const HandleRemap &remap)
+{
+    int count = in.readI32();
+
+    // Each log needs at least a handle and four length prefixes
+    if (!in.ok() || count < 0 || (size_t)count > in.remaining() / 20)
+    {
+        return false;
+    }
+
+    FlightLog *logs = new FlightLog[count > 0 ? count : 1];
+    for (int i = 0; i < count && in.ok(); i++)
+    {
+        FlightHandle flightID = remap.map(in.readU32());
+        string origin = in.readString();
+        string destination = in.readString();
+        string arrivalTime = in.readString();
+        string result = in.readString();
+        logs[i] = FlightLog(flightID, origin, destination, arrivalTime, result);
+    }
+
+    bool success = in.ok();
+    if (success)
+    {
+        // Logs were saved in order, so the tree is rebuilt in O(n) without rotations
+        nodePool.releaseAll();
+        root = buildBalanced(logs, 0, count - 1);
+    }
+
+    delete[] logs;
+    return success;
+}
@@ -7,24 +7,36 @@
 #include <iomanip>
 #include <algorithm>
 #include <cstdlib>
+#include "IDInterner.h"
+#include "BinaryIO.h"
+#include "NodePool.h"
+#include "HashTable.h"
 
 using namespace std;
 
+// Arrival time characters kept per log (longer times are cut short)
+const int LOG_TIME_LENGTH = 23;
+
 // ========== FLIGHT LOG STRUCTURE ==========
+// Plain data, so tree nodes have nothing to destruct and the node pool
+// frees a whole tree at once: airports are dictionary codes, the result
+// is a status code and the arrival time (the tree key) is kept inline
 struct FlightLog
 {
-    string flightID;
-    string origin;
-    string destination;
-    string arrivalTime;
-    string result; // "LANDED" or "CRASHED"
-
-    FlightLog() : flightID(""), origin(""), destination(""),
-                  arrivalTime(""), result("") {}
-
-    FlightLog(string id, string org, string dest, string time, string res)
-        : flightID(id), origin(org), destination(dest),
-          arrivalTime(time), result(res) {}
+    FlightHandle flightID;    // interned flight ID
+    FlightHandle origin;      // airportNames() code
+    FlightHandle destination; // airportNames() code
+    char arrivalTime[LOG_TIME_LENGTH + 1];
+    AircraftStatus result; // LANDED or CRASHED
+
+    FlightLog() : flightID(NO_FLIGHT), origin(NO_FLIGHT), destination(NO_FLIGHT),
+                  result(AIRCRAFT_UNKNOWN)
+    {
+        arrivalTime[0] = '\0';
+    }
+
+    FlightLog(FlightHandle id, const string &org, const string &dest,
+              const string &time, const string &res);
 };
 
 // ========== AVL TREE NODE ==========
@@ -35,7 +47,7 @@ struct AVLNode
     AVLNode *right;
     int height;
 
-    AVLNode(FlightLog log) : logData(log), left(NULL), right(NULL), height(1) {}
+    AVLNode(const FlightLog &log) : logData(log), left(NULL), right(NULL), height(1) {}
 };
 
 // ========== AVL TREE CLASS ==========
@@ -43,6 +55,7 @@ class AVLTree
 {
 private:
     AVLNode *root;
+    NodePool<AVLNode> nodePool; // every tree node
 
     // Helper functions
     int getHeight(AVLNode *node);
@@ -51,13 +64,17 @@ private:
     AVLNode *rotateRight(AVLNode *node);
     AVLNode *rotateLeft(AVLNode *node);
 
-    AVLNode *insertNode(AVLNode *node, FlightLog log);
-    AVLNode *deleteNode(AVLNode *node, string flightID);
+    AVLNode *insertNode(AVLNode *node, const FlightLog &log);
+    AVLNode *deleteNode(AVLNode *node, FlightHandle flightID);
     AVLNode *findMin(AVLNode *node);
 
     void inOrderTraversal(AVLNode *node);
-    AVLNode *searchNode(AVLNode *node, string flightID);
-    void deleteTree(AVLNode *node);
+    AVLNode *searchNode(AVLNode *node, FlightHandle flightID);
+
+    // Snapshot helpers
+    int countNodes(AVLNode *node);
+    void saveInOrder(AVLNode *node, BinaryWriter &out);
+    AVLNode *buildBalanced(FlightLog *logs, int first, int last);
 
 public:
     // Constructor & Destructor
@@ -65,14 +82,14 @@ public:
     ~AVLTree();
 
     // Insert flight log
-    void insertLog(string flightID, string origin, string destination,
-                   string time, string result);
+    void insertLog(const string &flightID, const string &origin, const string &destination,
+                   const string &time, const string &result);
 
     // Delete flight log
-    bool deleteLog(string flightID);
+    bool deleteLog(const string &flightID);
 
     // Search flight log
-    FlightLog *searchLog(string flightID);
+    FlightLog *searchLog(const string &flightID);
 
     // Print all logs in chronological order
     void printAllLogs();
@@ -82,6 +99,10 @@ public:
 
     // Check if tree is empty
     bool isEmpty();
+
+    // Binary snapshot section (see Snapshot.h)
+    void saveBinary(BinaryWriter &out);
+    bool loadBinary(BinaryReader &in, const HandleRemap &remap);
 };
 
 #endif // AVLTREE_H
\ No newline at end of file
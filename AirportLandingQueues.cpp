@@ -0,0 +1,468 @@
+#include "AirportLandingQueues.h"
+#include "MinHeap.h"
+#include "BucketQueue.h"
+#include "Logger.h"
+#include <iostream>
+#include <iomanip>
+
+using namespace std;
+
+// ========== COLOR CODES ==========
+const string RED = "\033[31m";
+const string GREEN = "\033[32m";
+const string YELLOW = "\033[33m";
+const string CYAN = "\033[36m";
+const string RESET = "\033[0m";
+const string BOLD = "\033[1m";
+
+// Display name and color per priority (index = priority - 1)
+const string PRIORITY_NAMES[LANDING_PRIORITIES] = {"CRITICAL", "LOW FUEL", "NORMAL", "LOW"};
+const string PRIORITY_COLORS[LANDING_PRIORITIES] = {RED, YELLOW, GREEN, CYAN};
+
+// ========== CONSTRUCTOR ==========
+AirportLandingQueues::AirportLandingQueues()
+{
+    kind = QUEUE_HEAP;
+    airportCount = 0;
+    size = 0;
+    urgentCount = 0;
+    for (int i = 0; i < MAX_NODES; i++)
+    {
+        slotOfAirport[i] = -1;
+        urgentPos[i] = 0;
+        headKey[i] = 0;
+    }
+
+    airportOf = NULL;
+    capacity = 0;
+
+    reserve(64);
+
+    LOG_INFO << GREEN << "[SUCCESS] Landing Queues initialized (one per airport)" << RESET;
+}
+
+// ========== DESTRUCTOR ==========
+AirportLandingQueues::~AirportLandingQueues()
+{
+    for (int i = 0; i < airportCount; i++)
+    {
+        delete airports[i].queue;
+    }
+
+    delete[] airportOf;
+}
+
+// ========== GROW PER-FLIGHT ARRAY ==========
+void AirportLandingQueues::reserve(int handleCount)
+{
+    if (handleCount <= capacity)
+    {
+        return;
+    }
+
+    int newCapacity = capacity > 0 ? capacity : 64;
+    while (newCapacity < handleCount)
+    {
+        newCapacity *= 2;
+    }
+
+    int *newAirportOf = new int[newCapacity];
+    for (int i = 0; i < newCapacity; i++)
+    {
+        newAirportOf[i] = i < capacity ? airportOf[i] : -1;
+    }
+
+    delete[] airportOf;
+    airportOf = newAirportOf;
+    capacity = newCapacity;
+}
+
+// ========== QUEUE KIND ==========
+void AirportLandingQueues::setKind(LandingQueueKind newKind)
+{
+    kind = newKind;
+}
+
+LandingQueueKind AirportLandingQueues::getKind()
+{
+    return kind;
+}
+
+// ========== FIND / CREATE AIRPORT ==========
+int AirportLandingQueues::findAirport(int airportID, bool create)
+{
+    if (airportID < 0 || airportID >= MAX_NODES)
+    {
+        return -1;
+    }
+    if (slotOfAirport[airportID] != -1 || !create)
+    {
+        return slotOfAirport[airportID];
+    }
+
+    // Both queue types land in the same order (LandingQueue.h); the
+    // bucket queue uses per-priority lists instead of comparisons
+    AirportQueue &a = airports[airportCount];
+    a.airportID = airportID;
+    if (kind == QUEUE_BUCKETS)
+    {
+        a.queue = new BucketQueue();
+    }
+    else
+    {
+        a.queue = new MinHeap();
+    }
+    urgentPos[airportCount] = 0;
+    slotOfAirport[airportID] = airportCount;
+
+    LOG_DEBUG << "[LANDING] Opened landing queue for airport " << airportID;
+    return airportCount++;
+}
+
+// ========== URGENCY INDEX ==========
+void AirportLandingQueues::placeUrgent(int index, int slot)
+{
+    urgent[index] = slot;
+    urgentPos[slot] = index;
+}
+
+void AirportLandingQueues::siftUp(int index)
+{
+    int slot = urgent[index];
+    while (index > 1 && headKey[urgent[index / 2]] > headKey[slot])
+    {
+        placeUrgent(index, urgent[index / 2]);
+        index /= 2;
+    }
+    placeUrgent(index, slot);
+}
+
+void AirportLandingQueues::siftDown(int index)
+{
+    int slot = urgent[index];
+    while (2 * index <= urgentCount)
+    {
+        int child = 2 * index;
+        if (child < urgentCount && headKey[urgent[child + 1]] < headKey[urgent[child]])
+        {
+            child++;
+        }
+        if (headKey[urgent[child]] >= headKey[slot])
+        {
+            break;
+        }
+        placeUrgent(index, urgent[child]);
+        index = child;
+    }
+    placeUrgent(index, slot);
+}
+
+void AirportLandingQueues::refresh(int slot)
+{
+    LandingQueue *queue = airports[slot].queue;
+    int index = urgentPos[slot];
+
+    if (queue->isEmpty())
+    {
+        // Take the airport out of the index
+        if (index != 0)
+        {
+            int last = urgent[urgentCount--];
+            urgentPos[slot] = 0;
+            if (last != slot)
+            {
+                placeUrgent(index, last);
+                siftUp(index);
+                siftDown(urgentPos[last]);
+            }
+        }
+        return;
+    }
+
+    // Both queue types keep the shared landing order (LandingQueue.h),
+    // so the head's priority and ETA are the smallest in the queue; ties
+    // go to the airport opened first
+    Flight next = queue->getNextFlight();
+    int eta = next.eta < 0 ? 0 : (next.eta > KEY_MAX_ETA ? KEY_MAX_ETA : next.eta);
+    headKey[slot] = ((unsigned long long)next.priority << KEY_PRIORITY_SHIFT) |
+                    ((unsigned long long)eta << KEY_ETA_SHIFT) |
+                    (unsigned long long)slot;
+
+    if (index == 0)
+    {
+        urgent[++urgentCount] = slot;
+        index = urgentCount;
+    }
+    siftUp(index);
+    siftDown(urgentPos[slot]);
+}
+
+// ========== INSERT FLIGHT ==========
+void AirportLandingQueues::insert(FlightHandle flightID, int airportID, int priority, int eta)
+{
+    if (priority < 1 || priority > LANDING_PRIORITIES)
+    {
+        LOG_ERROR << RED << "[ERROR]" << RESET << " Invalid priority " << priority
+                  << " for flight " << flightIDs().getName(flightID);
+        return;
+    }
+
+    reserve((int)flightID + 1);
+    if (airportOf[flightID] != -1)
+    {
+        LOG_WARNING << YELLOW << "[WARNING]" << RESET << " Flight " << flightIDs().getName(flightID)
+                    << " is already in a landing queue";
+        return;
+    }
+
+    int slot = findAirport(airportID, true);
+    if (slot == -1)
+    {
+        LOG_ERROR << RED << "[ERROR]" << RESET << " No landing queue available for airport " << airportID;
+        return;
+    }
+
+    airports[slot].queue->insert(flightID, priority, eta);
+    airportOf[flightID] = slot;
+    size++;
+    refresh(slot);
+}
+
+// ========== EXTRACT MOST URGENT FLIGHT ==========
+Flight AirportLandingQueues::extractMin()
+{
+    if (urgentCount == 0)
+    {
+        LOG_ERROR << RED << "[ERROR]" << RESET << " Landing queue is empty!";
+        return Flight(NO_FLIGHT, -1);
+    }
+
+    int slot = urgent[1];
+    Flight landed = airports[slot].queue->extractMin();
+    airportOf[landed.flightID] = -1;
+    size--;
+    refresh(slot);
+    return landed;
+}
+
+// ========== NEXT AIRPORT ==========
+int AirportLandingQueues::getNextAirport()
+{
+    return urgentCount > 0 ? airports[urgent[1]].airportID : -1;
+}
+
+// ========== UPDATE PRIORITY ==========
+void AirportLandingQueues::updatePriority(FlightHandle flightID, int newPriority)
+{
+    if (!contains(flightID))
+    {
+        LOG_ERROR << RED << "[ERROR]" << RESET << " Flight " << flightIDs().getName(flightID)
+                  << " not found in landing queue!";
+        return;
+    }
+
+    int slot = airportOf[flightID];
+    airports[slot].queue->updatePriority(flightID, newPriority);
+    refresh(slot);
+}
+
+// ========== REMOVE FLIGHT ==========
+bool AirportLandingQueues::remove(FlightHandle flightID)
+{
+    if (!contains(flightID))
+    {
+        return false;
+    }
+
+    int slot = airportOf[flightID];
+    airports[slot].queue->remove(flightID);
+    airportOf[flightID] = -1;
+    size--;
+    refresh(slot);
+    return true;
+}
+
+// ========== LOOKUPS ==========
+bool AirportLandingQueues::contains(FlightHandle flightID)
+{
+    return flightID != NO_FLIGHT && (int)flightID < capacity && airportOf[flightID] != -1;
+}
+
+int AirportLandingQueues::getAirportOf(FlightHandle flightID)
+{
+    return contains(flightID) ? airports[airportOf[flightID]].airportID : -1;
+}
+
+LandingQueue *AirportLandingQueues::getQueue(int airportID)
+{
+    int slot = findAirport(airportID, false);
+    return slot == -1 ? NULL : airports[slot].queue;
+}
+
+bool AirportLandingQueues::isEmpty()
+{
+    return size == 0;
+}
+
+int AirportLandingQueues::getSize()
+{
+    return size;
+}
+
+int AirportLandingQueues::getAirportCount()
+{
+    return airportCount;
+}
+
+// ========== CLEAR ==========
+void AirportLandingQueues::clear()
+{
+    for (int i = 0; i < airportCount; i++)
+    {
+        slotOfAirport[airports[i].airportID] = -1;
+        delete airports[i].queue;
+        airports[i] = AirportQueue();
+        urgentPos[i] = 0;
+    }
+    for (int i = 0; i < capacity; i++)
+    {
+        airportOf[i] = -1;
+    }
+
+    airportCount = 0;
+    urgentCount = 0;
+    size = 0;
+}
+
+// ========== DISPLAY LANDING QUEUES ==========
+void AirportLandingQueues::displayQueues(Graph *graph)
+{
+    logger().flush();
+
+    cout << BOLD << CYAN << "\n+=============================================================+\n";
+    cout << "|              " << YELLOW << "LANDING PRIORITY QUEUES" << CYAN << "                    |\n";
+    cout << "+=============================================================+\n"
+         << RESET << endl;
+
+    if (size == 0)
+    {
+        cout << YELLOW << "  No flights waiting to land\n"
+             << RESET << endl;
+        return;
+    }
+
+    Node *next = graph != NULL ? graph->getNode(getNextAirport()) : NULL;
+    cout << BOLD << "  +----------------------------------------------------------+\n";
+    cout << "  | " << RESET << "Total Waiting: " << CYAN << setw(4) << left << size << RESET
+         << "Next Airport: " << CYAN << setw(12) << (next != NULL ? next->name : "-") << right
+         << RESET << BOLD << "             |\n";
+    cout << "  +----------------------------------------------------------+\n"
+         << RESET << endl;
+
+    for (int i = 0; i < airportCount; i++)
+    {
+        LandingQueue *queue = airports[i].queue;
+        int count = queue->getSize();
+        if (count == 0)
+        {
+            continue;
+        }
+
+        Node *airport = graph != NULL ? graph->getNode(airports[i].airportID) : NULL;
+        cout << BOLD << "  " << (airport != NULL ? airport->name : "Airport")
+             << RESET << " (" << count << " waiting)" << endl;
+
+        Flight *ordered = new Flight[count];
+        count = queue->listInOrder(ordered, count);
+        for (int p = 0; p < count; p++)
+        {
+            int b = ordered[p].priority - 1;
+            cout << BOLD << "    " << setw(2) << p + 1 << ". " << RESET
+                 << CYAN << setw(12) << flightIDs().getName(ordered[p].flightID) << RESET << " | "
+                 << PRIORITY_COLORS[b] << BOLD << setw(12) << PRIORITY_NAMES[b] << RESET
+                 << " | ETA tick " << ordered[p].eta << endl;
+        }
+        delete[] ordered;
+    }
+
+    cout << endl;
+}
+
+// ========== SAVE BINARY SECTION ==========
+void AirportLandingQueues::saveBinary(BinaryWriter &out)
+{
+    // Airports with waiting flights, each followed by its own queue
+    int nonEmpty = 0;
+    for (int i = 0; i < airportCount; i++)
+    {
+        if (!airports[i].queue->isEmpty())
+        {
+            nonEmpty++;
+        }
+    }
+
+    out.writeI32(nonEmpty);
+    for (int i = 0; i < airportCount; i++)
+    {
+        if (!airports[i].queue->isEmpty())
+        {
+            out.writeI32(airports[i].airportID);
+            airports[i].queue->saveBinary(out);
+        }
+    }
+}
+
+// ========== LOAD BINARY SECTION ==========
+bool AirportLandingQueues::loadBinary(BinaryReader &in, const HandleRemap &remap)
+{
+    int count = in.readI32();
+    if (!in.ok() || count < 0 || count > MAX_NODES)
+    {
+        return false;
+    }
+
+    clear();
+    reserve(flightIDs().getCount() + 1);
+
+    for (int a = 0; a < count; a++)
+    {
+        int airportID = in.readI32();
+        if (!in.ok() || findAirport(airportID, false) != -1)
+        {
+            return false;
+        }
+
+        int slot = findAirport(airportID, true);
+        LandingQueue *queue = airports[slot].queue;
+        if (!queue->loadBinary(in, remap))
+        {
+            return false;
+        }
+
+        // A flight is queued at one airport only
+        int queued = queue->getSize();
+        Flight *loaded = new Flight[queued];
+        queued = queue->listInOrder(loaded, queued);
+        bool unique = true;
+        for (int i = 0; i < queued; i++)
+        {
+            FlightHandle h = loaded[i].flightID;
+            reserve((int)h + 1);
+            if (airportOf[h] != -1)
+            {
+                unique = false;
+            }
+            airportOf[h] = slot;
+        }
+        delete[] loaded;
+
+        if (!unique)
+        {
+            return false;
+        }
+        size += queued;
+        refresh(slot);
+    }
+
+    return in.ok();
+}
@@ -0,0 +1,115 @@
+#ifndef AIRPORT_LANDING_QUEUES_H
+#define AIRPORT_LANDING_QUEUES_H
+
+#include "LandingQueue.h"
+#include "Graph.h"
+
+using namespace std;
+
+// Queue type used for every airport
+enum LandingQueueKind
+{
+    QUEUE_HEAP,   // MinHeap
+    QUEUE_BUCKETS // BucketQueue
+};
+
+// ========== AIRPORT QUEUE ==========
+struct AirportQueue
+{
+    int airportID;
+    LandingQueue *queue;
+
+    AirportQueue() : airportID(-1), queue(NULL) {}
+};
+
+// ========== AIRPORT LANDING QUEUES CLASS ==========
+// One landing queue per destination airport, created when its first
+// flight is queued. Airports are sequenced independently; a small
+// indexed min-heap over the airports, keyed by the priority and ETA of
+// each airport's next flight, finds the most urgent airport in O(1)
+// and is re-keyed in O(log A) whenever an airport's head changes.
+// Airport IDs are node IDs (below MAX_NODES), so finding an airport's
+// queue is one array lookup.
+class AirportLandingQueues
+{
+private:
+    LandingQueueKind kind;
+
+    AirportQueue airports[MAX_NODES]; // created on first landing
+    int slotOfAirport[MAX_NODES];     // airport ID -> slot (-1 = none)
+    int airportCount;
+    int size;
+
+    // Urgency index: 1-indexed heap of airport slots, the slot's heap
+    // index (0 while its queue is empty) and its head key
+    int urgent[MAX_NODES + 1];
+    int urgentPos[MAX_NODES];
+    unsigned long long headKey[MAX_NODES];
+    int urgentCount;
+
+    // Per handle: airport slot the flight is queued at (-1 = none)
+    int *airportOf;
+    int capacity;
+
+    void reserve(int handleCount);
+
+    // Slot of an airport (-1 if none and not created)
+    int findAirport(int airportID, bool create);
+
+    // Re-key an airport after its queue changed
+    void refresh(int slot);
+    void siftUp(int index);
+    void siftDown(int index);
+    void placeUrgent(int index, int slot);
+
+    // Not copyable
+    AirportLandingQueues(const AirportLandingQueues &other);
+    AirportLandingQueues &operator=(const AirportLandingQueues &other);
+
+public:
+    // Constructor & Destructor
+    AirportLandingQueues();
+    ~AirportLandingQueues();
+
+    // Queue type for airports created from now on (set at start-up)
+    void setKind(LandingQueueKind newKind);
+    LandingQueueKind getKind();
+
+    // Queue a flight at its destination airport
+    void insert(FlightHandle flightID, int airportID, int priority, int eta = 0);
+
+    // Land the most urgent flight across all airports
+    Flight extractMin();
+
+    // Airport of the most urgent flight (-1 when nothing is queued)
+    int getNextAirport();
+
+    // Change priority of a queued flight (emergency override)
+    void updatePriority(FlightHandle flightID, int newPriority);
+
+    // Take a flight out of its airport's queue; false if not queued
+    bool remove(FlightHandle flightID);
+
+    // Check if a flight is queued / where
+    bool contains(FlightHandle flightID);
+    int getAirportOf(FlightHandle flightID);
+
+    // Landing queue of one airport (NULL until a flight is queued there)
+    LandingQueue *getQueue(int airportID);
+
+    bool isEmpty();
+    int getSize();
+    int getAirportCount();
+
+    // Drop every airport queue
+    void clear();
+
+    // Display each airport's landing sequence
+    void displayQueues(Graph *graph);
+
+    // Binary snapshot section (see Snapshot.h)
+    void saveBinary(BinaryWriter &out);
+    bool loadBinary(BinaryReader &in, const HandleRemap &remap);
+};
+
+#endif // AIRPORT_LANDING_QUEUES_H
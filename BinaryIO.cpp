@@ -0,0 +1,328 @@
+#include "BinaryIO.h"
+#include <cstdio>
+#include <cstring>
+#include <cstdlib>
+
+#ifdef _WIN32
+#include <fstream>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+using namespace std;
+
+// ========== WRITER: CONSTRUCTOR ==========
+BinaryWriter::BinaryWriter()
+{
+    capacity = 4096;
+    size = 0;
+    data = (char *)malloc(capacity);
+}
+
+// ========== WRITER: DESTRUCTOR ==========
+BinaryWriter::~BinaryWriter()
+{
+    free(data);
+}
+
+// ========== WRITER: ENSURE SPACE ==========
+void BinaryWriter::reserve(size_t extra)
+{
+    if (size + extra <= capacity)
+    {
+        return;
+    }
+
+    while (size + extra > capacity)
+    {
+        capacity *= 2;
+    }
+    data = (char *)realloc(data, capacity);
+}
+
+// ========== WRITER: FIELDS ==========
+void BinaryWriter::writeBytes(const void *bytes, size_t length)
+{
+    reserve(length);
+    memcpy(data + size, bytes, length);
+    size += length;
+}
+
+void BinaryWriter::writeU8(unsigned char value)
+{
+    writeBytes(&value, 1);
+}
+
+void BinaryWriter::writeU32(unsigned int value)
+{
+    writeBytes(&value, 4);
+}
+
+void BinaryWriter::writeI32(int value)
+{
+    writeBytes(&value, 4);
+}
+
+void BinaryWriter::writeU64(unsigned long long value)
+{
+    writeBytes(&value, 8);
+}
+
+void BinaryWriter::writeString(const string &value)
+{
+    writeU32((unsigned int)value.length());
+    writeBytes(value.data(), value.length());
+}
+
+void BinaryWriter::patchU32(size_t offset, unsigned int value)
+{
+    if (offset + 4 <= size)
+    {
+        memcpy(data + offset, &value, 4);
+    }
+}
+
+// ========== WRITER: BUFFER ACCESS ==========
+const char *BinaryWriter::getData() const
+{
+    return data;
+}
+
+size_t BinaryWriter::getSize() const
+{
+    return size;
+}
+
+void BinaryWriter::clear()
+{
+    size = 0;
+}
+
+// ========== READER: CONSTRUCTOR ==========
+BinaryReader::BinaryReader(const char *bytes, size_t length)
+{
+    data = bytes;
+    size = length;
+    pos = 0;
+    failed = false;
+}
+
+// ========== READER: FIELDS ==========
+bool BinaryReader::readBytes(void *bytes, size_t length)
+{
+    if (failed || length > size - pos)
+    {
+        failed = true;
+        memset(bytes, 0, length);
+        return false;
+    }
+
+    memcpy(bytes, data + pos, length);
+    pos += length;
+    return true;
+}
+
+unsigned char BinaryReader::readU8()
+{
+    unsigned char value;
+    readBytes(&value, 1);
+    return value;
+}
+
+unsigned int BinaryReader::readU32()
+{
+    unsigned int value;
+    readBytes(&value, 4);
+    return value;
+}
+
+int BinaryReader::readI32()
+{
+    int value;
+    readBytes(&value, 4);
+    return value;
+}
+
+unsigned long long BinaryReader::readU64()
+{
+    unsigned long long value;
+    readBytes(&value, 8);
+    return value;
+}
+
+string BinaryReader::readString()
+{
+    unsigned int length = readU32();
+
+    if (failed || length > size - pos)
+    {
+        failed = true;
+        return "";
+    }
+
+    string value(data + pos, length);
+    pos += length;
+    return value;
+}
+
+// ========== READER: STATE ==========
+bool BinaryReader::ok() const
+{
+    return !failed;
+}
+
+void BinaryReader::fail()
+{
+    failed = true;
+}
+
+size_t BinaryReader::getPosition() const
+{
+    return pos;
+}
+
+size_t BinaryReader::remaining() const
+{
+    return size - pos;
+}
+
+// ========== MAPPED FILE: CONSTRUCTOR ==========
+MappedFile::MappedFile()
+{
+    data = NULL;
+    size = 0;
+    mapped = false;
+}
+
+// ========== MAPPED FILE: DESTRUCTOR ==========
+MappedFile::~MappedFile()
+{
+    close();
+}
+
+// ========== MAPPED FILE: OPEN ==========
+bool MappedFile::open(const string &filename)
+{
+    close();
+
+#ifdef _WIN32
+    ifstream file(filename.c_str(), ios::binary | ios::ate);
+    if (!file.is_open())
+    {
+        return false;
+    }
+
+    size = (size_t)file.tellg();
+    char *buffer = (char *)malloc(size > 0 ? size : 1);
+    file.seekg(0);
+    file.read(buffer, size);
+    data = buffer;
+    mapped = false;
+    return true;
+#else
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0)
+    {
+        ::close(fd);
+        return false;
+    }
+
+    size = (size_t)info.st_size;
+    if (size == 0)
+    {
+        ::close(fd);
+        data = NULL;
+        return true;
+    }
+
+    void *view = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+
+    if (view == MAP_FAILED)
+    {
+        size = 0;
+        return false;
+    }
+
+    // The whole file is parsed front to back
+    madvise(view, size, MADV_SEQUENTIAL);
+
+    data = (const char *)view;
+    mapped = true;
+    return true;
+#endif
+}
+
+// ========== MAPPED FILE: CLOSE ==========
+void MappedFile::close()
+{
+    if (data != NULL)
+    {
+#ifdef _WIN32
+        free((void *)data);
+#else
+        if (mapped)
+        {
+            munmap((void *)data, size);
+        }
+#endif
+    }
+
+    data = NULL;
+    size = 0;
+    mapped = false;
+}
+
+// ========== MAPPED FILE: ACCESS ==========
+const char *MappedFile::getData() const
+{
+    return data;
+}
+
+size_t MappedFile::getSize() const
+{
+    return size;
+}
+
+// ========== WRITE WHOLE FILE ==========
+bool writeWholeFile(const string &filename, const char *bytes, size_t length)
+{
+    FILE *file = fopen(filename.c_str(), "wb");
+    if (file == NULL)
+    {
+        return false;
+    }
+
+    size_t written = fwrite(bytes, 1, length, file);
+    bool success = (written == length);
+
+    if (fclose(file) != 0)
+    {
+        success = false;
+    }
+
+    return success;
+}
+
+// ========== CHECKSUM (FNV-1a) ==========
+unsigned int checksumBytes(const char *bytes, size_t length, unsigned int seed)
+{
+    unsigned int hash = seed;
+
+    for (size_t i = 0; i < length; i++)
+    {
+        hash ^= (unsigned char)bytes[i];
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
@@ -0,0 +1,102 @@
+#ifndef BINARYIO_H
+#define BINARYIO_H
+
+#include <string>
+#include <cstddef>
+
+using namespace std;
+
+// ========== BINARY WRITER ==========
+// Appends fixed-width little-endian fields to a growable memory buffer
+// so a whole file can be produced with a single sequential write.
+class BinaryWriter
+{
+private:
+    char *data;
+    size_t size;
+    size_t capacity;
+
+    void reserve(size_t extra);
+
+public:
+    // Constructor & Destructor
+    BinaryWriter();
+    ~BinaryWriter();
+
+    // Field writers
+    void writeBytes(const void *bytes, size_t length);
+    void writeU8(unsigned char value);
+    void writeU32(unsigned int value);
+    void writeI32(int value);
+    void writeU64(unsigned long long value);
+    void writeString(const string &value);
+
+    // Overwrite a previously written 32-bit field (e.g. a count)
+    void patchU32(size_t offset, unsigned int value);
+
+    // Buffer access
+    const char *getData() const;
+    size_t getSize() const;
+    void clear();
+};
+
+// ========== BINARY READER ==========
+// Reads fields back from a memory range (usually a mapped file).
+// Any read past the end sets the failed flag and returns zeros.
+class BinaryReader
+{
+private:
+    const char *data;
+    size_t size;
+    size_t pos;
+    bool failed;
+
+public:
+    // Constructor
+    BinaryReader(const char *bytes, size_t length);
+
+    // Field readers
+    bool readBytes(void *bytes, size_t length);
+    unsigned char readU8();
+    unsigned int readU32();
+    int readI32();
+    unsigned long long readU64();
+    string readString();
+
+    // State
+    bool ok() const;
+    void fail();
+    size_t getPosition() const;
+    size_t remaining() const;
+};
+
+// ========== MAPPED FILE ==========
+// Read-only view of a whole file (mmap on POSIX, buffered read on Windows)
+class MappedFile
+{
+private:
+    const char *data;
+    size_t size;
+    bool mapped;
+
+public:
+    // Constructor & Destructor
+    MappedFile();
+    ~MappedFile();
+
+    // Open / close the file
+    bool open(const string &filename);
+    void close();
+
+    // Access mapped bytes
+    const char *getData() const;
+    size_t getSize() const;
+};
+
+// Write a buffer to disk in one sequential pass
+bool writeWholeFile(const string &filename, const char *bytes, size_t length);
+
+// FNV-1a checksum over a byte range
+unsigned int checksumBytes(const char *bytes, size_t length, unsigned int seed = 2166136261u);
+
+#endif // BINARYIO_H
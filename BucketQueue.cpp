@@ -0,0 +1,542 @@
+#include "BucketQueue.h"
+#include "Logger.h"
+#include <iostream>
+#include <iomanip>
+
+using namespace std;
+
+// ========== COLOR CODES ==========
+const string RED = "\033[31m";
+const string GREEN = "\033[32m";
+const string YELLOW = "\033[33m";
+const string CYAN = "\033[36m";
+const string RESET = "\033[0m";
+const string BOLD = "\033[1m";
+
+// Display name and color per priority (index = priority - 1)
+const string PRIORITY_NAMES[LANDING_PRIORITIES] = {"CRITICAL", "LOW FUEL", "NORMAL", "LOW"};
+const string PRIORITY_COLORS[LANDING_PRIORITIES] = {RED, YELLOW, GREEN, CYAN};
+
+// ========== CONSTRUCTOR ==========
+BucketQueue::BucketQueue()
+{
+    for (int b = 0; b < LANDING_PRIORITIES; b++)
+    {
+        head[b] = NO_FLIGHT;
+        tail[b] = NO_FLIGHT;
+        length[b] = 0;
+    }
+    size = 0;
+    arrivalHead = NO_FLIGHT;
+    arrivalTail = NO_FLIGHT;
+    nextSequence = 0;
+
+    next = NULL;
+    prev = NULL;
+    arrivalNext = NULL;
+    arrivalPrev = NULL;
+    priorityOf = NULL;
+    orderOf = NULL;
+    capacity = 0;
+
+    reserve(64);
+
+    LOG_DEBUG << "[LANDING] Landing Queue initialized (priority buckets)";
+}
+
+// ========== DESTRUCTOR ==========
+BucketQueue::~BucketQueue()
+{
+    delete[] next;
+    delete[] prev;
+    delete[] arrivalNext;
+    delete[] arrivalPrev;
+    delete[] priorityOf;
+    delete[] orderOf;
+}
+
+// ========== GROW PER-FLIGHT ARRAYS ==========
+void BucketQueue::reserve(int handleCount)
+{
+    if (handleCount <= capacity)
+    {
+        return;
+    }
+
+    int newCapacity = capacity > 0 ? capacity : 64;
+    while (newCapacity < handleCount)
+    {
+        newCapacity *= 2;
+    }
+
+    FlightHandle *newNext = new FlightHandle[newCapacity];
+    FlightHandle *newPrev = new FlightHandle[newCapacity];
+    FlightHandle *newArrivalNext = new FlightHandle[newCapacity];
+    FlightHandle *newArrivalPrev = new FlightHandle[newCapacity];
+    unsigned char *newPriorityOf = new unsigned char[newCapacity];
+    unsigned long long *newOrderOf = new unsigned long long[newCapacity];
+    for (int i = 0; i < newCapacity; i++)
+    {
+        bool old = i < capacity;
+        newNext[i] = old ? next[i] : NO_FLIGHT;
+        newPrev[i] = old ? prev[i] : NO_FLIGHT;
+        newArrivalNext[i] = old ? arrivalNext[i] : NO_FLIGHT;
+        newArrivalPrev[i] = old ? arrivalPrev[i] : NO_FLIGHT;
+        newPriorityOf[i] = old ? priorityOf[i] : 0;
+        newOrderOf[i] = old ? orderOf[i] : 0;
+    }
+
+    delete[] next;
+    delete[] prev;
+    delete[] arrivalNext;
+    delete[] arrivalPrev;
+    delete[] priorityOf;
+    delete[] orderOf;
+
+    next = newNext;
+    prev = newPrev;
+    arrivalNext = newArrivalNext;
+    arrivalPrev = newArrivalPrev;
+    priorityOf = newPriorityOf;
+    orderOf = newOrderOf;
+    capacity = newCapacity;
+}
+
+// ========== CLEAR ==========
+void BucketQueue::clear()
+{
+    for (int b = 0; b < LANDING_PRIORITIES; b++)
+    {
+        head[b] = NO_FLIGHT;
+        tail[b] = NO_FLIGHT;
+        length[b] = 0;
+    }
+    for (int i = 0; i < capacity; i++)
+    {
+        next[i] = NO_FLIGHT;
+        prev[i] = NO_FLIGHT;
+        arrivalNext[i] = NO_FLIGHT;
+        arrivalPrev[i] = NO_FLIGHT;
+        priorityOf[i] = 0;
+    }
+    size = 0;
+    arrivalHead = NO_FLIGHT;
+    arrivalTail = NO_FLIGHT;
+    nextSequence = 0;
+}
+
+// ========== ARRIVAL LIST ==========
+void BucketQueue::linkArrival(FlightHandle flightID)
+{
+    // Flights normally arrive in order, so this stops at the tail
+    FlightHandle after = arrivalTail;
+    while (after != NO_FLIGHT && orderOf[after] > orderOf[flightID])
+        after = arrivalPrev[after];
+
+    FlightHandle before = after != NO_FLIGHT ? arrivalNext[after] : arrivalHead;
+    arrivalPrev[flightID] = after;
+    arrivalNext[flightID] = before;
+    if (after != NO_FLIGHT)
+        arrivalNext[after] = flightID;
+    else
+        arrivalHead = flightID;
+    if (before != NO_FLIGHT)
+        arrivalPrev[before] = flightID;
+    else
+        arrivalTail = flightID;
+}
+
+void BucketQueue::unlinkArrival(FlightHandle flightID)
+{
+    if (arrivalPrev[flightID] != NO_FLIGHT)
+        arrivalNext[arrivalPrev[flightID]] = arrivalNext[flightID];
+    else
+        arrivalHead = arrivalNext[flightID];
+
+    if (arrivalNext[flightID] != NO_FLIGHT)
+        arrivalPrev[arrivalNext[flightID]] = arrivalPrev[flightID];
+    else
+        arrivalTail = arrivalPrev[flightID];
+
+    arrivalNext[flightID] = NO_FLIGHT;
+    arrivalPrev[flightID] = NO_FLIGHT;
+}
+
+// ========== PLACE IN BUCKET ==========
+FlightHandle BucketQueue::findPlace(FlightHandle flightID, int priority)
+{
+    int b = priority - 1;
+    unsigned long long order = orderOf[flightID];
+
+    // Newest flight of this priority: append
+    if (tail[b] == NO_FLIGHT || orderOf[tail[b]] < order)
+    {
+        return tail[b];
+    }
+
+    // Older than the tail: the nearest earlier flight of this priority
+    // on the arrival list, or the last older flight in the bucket
+    FlightHandle earlier = arrivalPrev[flightID];
+    FlightHandle inBucket = tail[b];
+    while (true)
+    {
+        if (earlier == NO_FLIGHT)
+            return NO_FLIGHT;
+        if (priorityOf[earlier] == priority)
+            return earlier;
+        earlier = arrivalPrev[earlier];
+
+        inBucket = prev[inBucket];
+        if (inBucket == NO_FLIGHT)
+            return NO_FLIGHT;
+        if (orderOf[inBucket] < order)
+            return inBucket;
+    }
+}
+
+int BucketQueue::getETA(FlightHandle flightID)
+{
+    return (int)((orderOf[flightID] >> KEY_ETA_SHIFT) & KEY_MAX_ETA);
+}
+
+// ========== LINK / UNLINK ==========
+void BucketQueue::link(FlightHandle flightID, int priority)
+{
+    int b = priority - 1;
+    FlightHandle after = findPlace(flightID, priority);
+    FlightHandle before = after != NO_FLIGHT ? next[after] : head[b];
+
+    prev[flightID] = after;
+    next[flightID] = before;
+    if (after != NO_FLIGHT)
+        next[after] = flightID;
+    else
+        head[b] = flightID;
+    if (before != NO_FLIGHT)
+        prev[before] = flightID;
+    else
+        tail[b] = flightID;
+
+    priorityOf[flightID] = (unsigned char)priority;
+    length[b]++;
+    size++;
+}
+
+void BucketQueue::unlink(FlightHandle flightID)
+{
+    int b = priorityOf[flightID] - 1;
+
+    if (prev[flightID] != NO_FLIGHT)
+        next[prev[flightID]] = next[flightID];
+    else
+        head[b] = next[flightID];
+
+    if (next[flightID] != NO_FLIGHT)
+        prev[next[flightID]] = prev[flightID];
+    else
+        tail[b] = prev[flightID];
+
+    next[flightID] = NO_FLIGHT;
+    prev[flightID] = NO_FLIGHT;
+    priorityOf[flightID] = 0;
+    length[b]--;
+    size--;
+}
+
+// ========== FIRST NON-EMPTY BUCKET ==========
+int BucketQueue::firstBucket()
+{
+    for (int b = 0; b < LANDING_PRIORITIES; b++)
+    {
+        if (head[b] != NO_FLIGHT)
+        {
+            return b;
+        }
+    }
+    return -1;
+}
+
+// ========== INSERT ==========
+void BucketQueue::insert(const string &flightID, int priority)
+{
+    insert(flightIDs().intern(flightID), priority);
+}
+
+void BucketQueue::insert(FlightHandle flightID, int priority, int eta)
+{
+    if (flightID == NO_FLIGHT)
+    {
+        LOG_ERROR << RED << "[ERROR]" << RESET << " Invalid flight!";
+        return;
+    }
+
+    if (priority < 1 || priority > LANDING_PRIORITIES)
+    {
+        LOG_ERROR << RED << "[ERROR]" << RESET << " Invalid priority! Use 1-4";
+        return;
+    }
+
+    if (contains(flightID))
+    {
+        LOG_ERROR << RED << "[ERROR]" << RESET << " Flight " << CYAN << flightIDs().getName(flightID)
+                  << RESET << " is already in the landing queue";
+        return;
+    }
+
+    if (eta < 0)
+        eta = 0;
+    else if (eta > KEY_MAX_ETA)
+        eta = KEY_MAX_ETA;
+
+    reserve((int)flightID + 1);
+    orderOf[flightID] = ((unsigned long long)eta << KEY_ETA_SHIFT) | nextSequence++;
+    linkArrival(flightID);
+    link(flightID, priority);
+
+    LOG_DEBUG << GREEN << "[INSERT]" << RESET << " Flight " << CYAN << flightIDs().getName(flightID)
+              << RESET << " added to queue [" << YELLOW << PRIORITY_NAMES[priority - 1] << RESET << "]";
+}
+
+// ========== EXTRACT MINIMUM (LAND FLIGHT) ==========
+Flight BucketQueue::extractMin()
+{
+    int b = firstBucket();
+    if (b == -1)
+    {
+        LOG_ERROR << RED << "[ERROR]" << RESET << " Landing queue is empty!";
+        return Flight(NO_FLIGHT, -1);
+    }
+
+    FlightHandle flightID = head[b];
+    unlink(flightID);
+    unlinkArrival(flightID);
+    return Flight(flightID, b + 1, getETA(flightID));
+}
+
+// ========== UPDATE PRIORITY (EMERGENCY OVERRIDE) ==========
+void BucketQueue::updatePriority(const string &flightID, int newPriority)
+{
+    updatePriority(flightIDs().lookup(flightID), newPriority);
+}
+
+void BucketQueue::updatePriority(FlightHandle flightID, int newPriority)
+{
+    if (newPriority < 1 || newPriority > LANDING_PRIORITIES)
+    {
+        LOG_ERROR << RED << "[ERROR]" << RESET << " Invalid priority! Use 1-4";
+        return;
+    }
+
+    if (!contains(flightID))
+    {
+        LOG_ERROR << RED << "[ERROR]" << RESET << " Flight " << CYAN << flightIDs().getName(flightID)
+                  << RESET << " not found in queue";
+        return;
+    }
+
+    // The flight keeps its ETA and queue order in the new bucket
+    if (priorityOf[flightID] != newPriority)
+    {
+        unlink(flightID);
+        link(flightID, newPriority);
+    }
+
+    LOG_DEBUG << YELLOW << "[EMERGENCY]" << RESET << " Flight " << CYAN << flightIDs().getName(flightID)
+              << RESET << " priority updated to " << RED << PRIORITY_NAMES[newPriority - 1] << RESET;
+}
+
+// ========== REMOVE FLIGHT FROM QUEUE ==========
+bool BucketQueue::remove(FlightHandle flightID)
+{
+    if (!contains(flightID))
+    {
+        return false;
+    }
+
+    unlink(flightID);
+    unlinkArrival(flightID);
+    return true;
+}
+
+// ========== CHECK IF FLIGHT IS QUEUED ==========
+bool BucketQueue::contains(FlightHandle flightID)
+{
+    return flightID != NO_FLIGHT && (int)flightID < capacity && priorityOf[flightID] != 0;
+}
+
+// ========== GET NEXT FLIGHT TO LAND ==========
+Flight BucketQueue::getNextFlight()
+{
+    int b = firstBucket();
+    if (b == -1)
+    {
+        LOG_ERROR << RED << "[ERROR]" << RESET << " Landing queue is empty!";
+        return Flight(NO_FLIGHT, -1);
+    }
+
+    return Flight(head[b], b + 1, getETA(head[b]));
+}
+
+// ========== CHECK IF EMPTY ==========
+bool BucketQueue::isEmpty()
+{
+    return size == 0;
+}
+
+// ========== GET SIZE ==========
+int BucketQueue::getSize()
+{
+    return size;
+}
+
+// ========== LIST IN LANDING ORDER ==========
+int BucketQueue::listInOrder(Flight out[], int maxCount)
+{
+    int count = 0;
+    for (int b = 0; b < LANDING_PRIORITIES; b++)
+    {
+        for (FlightHandle h = head[b]; h != NO_FLIGHT && count < maxCount; h = next[h])
+        {
+            out[count++] = Flight(h, b + 1, getETA(h));
+        }
+    }
+    return count;
+}
+
+// ========== DISPLAY LANDING QUEUE ==========
+void BucketQueue::displayQueue()
+{
+    logger().flush();
+
+    cout << BOLD << CYAN << "\n+=============================================================+\n";
+    cout << "|              " << YELLOW << "LANDING PRIORITY QUEUE" << CYAN << "                     |\n";
+    cout << "+=============================================================+\n"
+         << RESET << endl;
+
+    if (size == 0)
+    {
+        cout << YELLOW << "  No flights waiting to land\n"
+             << RESET << endl;
+        return;
+    }
+
+    cout << BOLD << "  +----------------------------------------------------------+\n";
+    cout << "  | " << RESET << "Total Waiting: " << CYAN << size << RESET << BOLD
+         << "                               |\n";
+    cout << "  +----------------------------------------------------------+\n"
+         << RESET << endl;
+
+    // Buckets in priority order are already the landing order
+    int position = 1;
+    for (int b = 0; b < LANDING_PRIORITIES; b++)
+    {
+        for (FlightHandle h = head[b]; h != NO_FLIGHT; h = next[h])
+        {
+            cout << BOLD << "  " << setw(2) << position << ". " << RESET
+                 << CYAN << setw(12) << flightIDs().getName(h) << RESET << " | "
+                 << PRIORITY_COLORS[b] << BOLD << setw(12) << PRIORITY_NAMES[b] << RESET
+                 << " | ETA tick " << getETA(h) << endl;
+            position++;
+        }
+    }
+
+    cout << endl;
+}
+
+// ========== SAVE BINARY SECTION ==========
+void BucketQueue::saveBinary(BinaryWriter &out)
+{
+    out.writeI32(size);
+
+    for (int b = 0; b < LANDING_PRIORITIES; b++)
+    {
+        for (FlightHandle h = head[b]; h != NO_FLIGHT; h = next[h])
+        {
+            out.writeU32(h);
+            out.writeI32(b + 1);
+            out.writeI32(getETA(h));
+            out.writeU32((unsigned int)(orderOf[h] & KEY_SEQUENCE_MASK));
+        }
+    }
+}
+
+// ========== LOAD BINARY SECTION ==========
+bool BucketQueue::loadBinary(BinaryReader &in, const HandleRemap &remap)
+{
+    int count = in.readI32();
+    if (!in.ok() || count < 0 || (size_t)count > in.remaining() / 16)
+    {
+        return false;
+    }
+
+    clear();
+
+    // Saved sequence numbers are kept so ties resolve as before the save
+    reserve(flightIDs().getCount() + 1);
+    for (int i = 0; i < count && in.ok(); i++)
+    {
+        FlightHandle flightID = remap.map(in.readU32());
+        int priority = in.readI32();
+        int eta = in.readI32();
+        unsigned int sequence = in.readU32();
+        if (flightID == NO_FLIGHT || priority < 1 || priority > LANDING_PRIORITIES || contains(flightID))
+        {
+            clear();
+            return false;
+        }
+        if (eta < 0)
+            eta = 0;
+        else if (eta > KEY_MAX_ETA)
+            eta = KEY_MAX_ETA;
+
+        reserve((int)flightID + 1);
+        orderOf[flightID] = ((unsigned long long)eta << KEY_ETA_SHIFT) | sequence;
+        if (sequence >= nextSequence)
+        {
+            nextSequence = sequence + 1;
+        }
+
+        // Each bucket arrives sorted, so every flight goes at its tail
+        int b = priority - 1;
+        if (tail[b] != NO_FLIGHT && orderOf[tail[b]] > orderOf[flightID])
+        {
+            clear();
+            return false;
+        }
+        link(flightID, priority);
+    }
+
+    // The arrival list is the buckets merged by order key
+    FlightHandle cursor[LANDING_PRIORITIES];
+    for (int b = 0; b < LANDING_PRIORITIES; b++)
+    {
+        cursor[b] = head[b];
+    }
+    while (true)
+    {
+        int pick = -1;
+        for (int b = 0; b < LANDING_PRIORITIES; b++)
+        {
+            if (cursor[b] != NO_FLIGHT && (pick == -1 || orderOf[cursor[b]] < orderOf[cursor[pick]]))
+            {
+                pick = b;
+            }
+        }
+        if (pick == -1)
+        {
+            break;
+        }
+
+        FlightHandle flightID = cursor[pick];
+        cursor[pick] = next[flightID];
+        arrivalPrev[flightID] = arrivalTail;
+        arrivalNext[flightID] = NO_FLIGHT;
+        if (arrivalTail != NO_FLIGHT)
+            arrivalNext[arrivalTail] = flightID;
+        else
+            arrivalHead = flightID;
+        arrivalTail = flightID;
+    }
+
+    return in.ok();
+}
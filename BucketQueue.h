@@ -0,0 +1,101 @@
+#ifndef BUCKET_QUEUE_H
+#define BUCKET_QUEUE_H
+
+#include <string>
+#include "LandingQueue.h"
+
+using namespace std;
+
+// ========== BUCKET QUEUE CLASS ==========
+// Landing queue that uses the fact that there are only four priorities:
+// one list per priority, linked through per-handle arrays and kept in
+// (ETA, queue order), so it lands flights in the same order as MinHeap.
+//
+// Every queued flight is also on one arrival list in that order. A
+// flight that joins a bucket goes after the bucket's tail when it is
+// the newest (always, for flights queued as they reach their approach);
+// otherwise its place is found by walking back from the flight on the
+// arrival list and from the bucket tail together, stopping at whichever
+// finds it first. Extract and remove are O(1); insert and reprioritise
+// are O(1) unless the flight is older than flights already in its new
+// bucket, and then cost the shorter of the two walks.
+class BucketQueue : public LandingQueue
+{
+private:
+    FlightHandle head[LANDING_PRIORITIES];
+    FlightHandle tail[LANDING_PRIORITIES];
+    int length[LANDING_PRIORITIES];
+    int size;
+
+    // Arrival list: every queued flight in (ETA, queue order)
+    FlightHandle arrivalHead;
+    FlightHandle arrivalTail;
+
+    // Next enqueue sequence number (restored when a snapshot is loaded)
+    unsigned int nextSequence;
+
+    // Per handle: bucket links, arrival links, priority (0 when not
+    // queued) and order key (ETA and sequence, as in the heap key)
+    FlightHandle *next;
+    FlightHandle *prev;
+    FlightHandle *arrivalNext;
+    FlightHandle *arrivalPrev;
+    unsigned char *priorityOf;
+    unsigned long long *orderOf;
+    int capacity;
+
+    void reserve(int handleCount);
+
+    // Put a flight in / take it out of its place on the arrival list
+    void linkArrival(FlightHandle flightID);
+    void unlinkArrival(FlightHandle flightID);
+
+    // Insert into / unlink from the bucket of a priority, in order
+    void link(FlightHandle flightID, int priority);
+    void unlink(FlightHandle flightID);
+
+    // Flight the new entry follows in the bucket (NO_FLIGHT = head)
+    FlightHandle findPlace(FlightHandle flightID, int priority);
+
+    int getETA(FlightHandle flightID);
+
+    // Empty every list (also used when a snapshot section is rejected)
+    void clear();
+
+    // Highest-priority non-empty bucket (-1 when empty)
+    int firstBucket();
+
+    // Not copyable
+    BucketQueue(const BucketQueue &other);
+    BucketQueue &operator=(const BucketQueue &other);
+
+public:
+    // Constructor & Destructor
+    BucketQueue();
+    ~BucketQueue();
+
+    void insert(const string &flightID, int priority);
+    void insert(FlightHandle flightID, int priority, int eta = 0);
+
+    Flight extractMin();
+
+    void updatePriority(const string &flightID, int newPriority);
+    void updatePriority(FlightHandle flightID, int newPriority);
+
+    bool remove(FlightHandle flightID);
+    bool contains(FlightHandle flightID);
+
+    void displayQueue();
+
+    Flight getNextFlight();
+    bool isEmpty();
+    int getSize();
+    int listInOrder(Flight out[], int maxCount);
+
+    // Saved in landing order (see LandingQueue.h); a section whose
+    // buckets are out of order is rejected
+    void saveBinary(BinaryWriter &out);
+    bool loadBinary(BinaryReader &in, const HandleRemap &remap);
+};
+
+#endif // BUCKET_QUEUE_H
@@ -0,0 +1,214 @@
+#include "ChangeFeed.h"
+#include "Logger.h"
+#include <iostream>
+#include <iomanip>
+
+using namespace std;
+
+// ========== COLOR CODES ==========
+const string RED = "\033[31m";
+const string GREEN = "\033[32m";
+const string YELLOW = "\033[33m";
+const string CYAN = "\033[36m";
+const string RESET = "\033[0m";
+const string BOLD = "\033[1m";
+
+// Changes shown per displayChanges call
+const int DISPLAYED_CHANGES = 64;
+
+const string CHANGE_NAMES[] = {"INSERT", "UPDATE", "STATUS", "FUEL", "DELETE", "RESET"};
+
+// ========== CHANGE TYPE NAME ==========
+const string &changeTypeName(ChangeType type)
+{
+    return CHANGE_NAMES[type];
+}
+
+// ========== CONSTRUCTOR ==========
+ChangeFeed::ChangeFeed()
+{
+    slots = new FeedSlot[CHANGE_FEED_SIZE];
+    for (int i = 0; i < CHANGE_FEED_SIZE; i++)
+    {
+        slots[i].version.store(0, memory_order_relaxed);
+        slots[i].words[0].store(0, memory_order_relaxed);
+        slots[i].words[1].store(0, memory_order_relaxed);
+    }
+    nextSequence.store(1, memory_order_relaxed);
+    overruns.store(0, memory_order_relaxed);
+}
+
+// ========== DESTRUCTOR ==========
+ChangeFeed::~ChangeFeed()
+{
+    delete[] slots;
+}
+
+// ========== PUBLISH ==========
+void ChangeFeed::publish(ChangeType type, const Aircraft &aircraft)
+{
+    unsigned long long sequence = nextSequence.load(memory_order_relaxed);
+    FeedSlot &slot = slots[sequence & (CHANGE_FEED_SIZE - 1)];
+
+    // Odd version first, so a reader copying the old record sees the change
+    slot.version.store(2 * sequence + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+
+    slot.words[0].store((unsigned long long)aircraft.flightID |
+                            ((unsigned long long)aircraft.model << 32) |
+                            ((unsigned long long)aircraft.origin << 48),
+                        memory_order_relaxed);
+    slot.words[1].store((unsigned long long)aircraft.destination |
+                            ((unsigned long long)aircraft.fuel << 16) |
+                            ((unsigned long long)aircraft.status << 24) |
+                            ((unsigned long long)type << 32),
+                        memory_order_relaxed);
+
+    slot.version.store(2 * sequence + 2, memory_order_release);
+    nextSequence.store(sequence + 1, memory_order_release);
+}
+
+// ========== TAIL CURSOR ==========
+unsigned long long ChangeFeed::tail() const
+{
+    return nextSequence.load(memory_order_acquire);
+}
+
+// ========== POLL ==========
+int ChangeFeed::poll(unsigned long long &cursor, ChangeRecord out[], int maxCount,
+                     unsigned long long &missed)
+{
+    missed = 0;
+    int count = 0;
+
+    if (cursor == 0)
+    {
+        cursor = 1;
+    }
+
+    unsigned long long head = nextSequence.load(memory_order_acquire);
+    while (cursor < head && count < maxCount)
+    {
+        // Anything older than one ring behind the head is gone
+        unsigned long long oldest = head > (unsigned long long)CHANGE_FEED_SIZE ? head - CHANGE_FEED_SIZE : 1;
+        if (cursor < oldest)
+        {
+            missed += oldest - cursor;
+            cursor = oldest;
+        }
+
+        FeedSlot &slot = slots[cursor & (CHANGE_FEED_SIZE - 1)];
+        unsigned long long version = slot.version.load(memory_order_acquire);
+        unsigned long long word0 = slot.words[0].load(memory_order_relaxed);
+        unsigned long long word1 = slot.words[1].load(memory_order_relaxed);
+        atomic_thread_fence(memory_order_acquire);
+
+        if (version != 2 * cursor + 2 || slot.version.load(memory_order_relaxed) != version)
+        {
+            // Overwritten: the slot now belongs to a newer change, so
+            // everything up to one ring behind that change is gone
+            unsigned long long newer = (slot.version.load(memory_order_relaxed) - 1) / 2;
+            if (newer + 1 > head)
+            {
+                head = newer + 1;
+            }
+            continue;
+        }
+
+        ChangeRecord &record = out[count++];
+        record.sequence = cursor;
+        record.type = static_cast<ChangeType>((word1 >> 32) & 0xFF);
+        record.aircraft.flightID = (FlightHandle)(word0 & 0xFFFFFFFFull);
+        record.aircraft.model = (unsigned short)(word0 >> 32);
+        record.aircraft.origin = (unsigned short)(word0 >> 48);
+        record.aircraft.destination = (unsigned short)word1;
+        record.aircraft.fuel = (unsigned char)(word1 >> 16);
+        record.aircraft.status = (unsigned char)(word1 >> 24);
+        cursor++;
+    }
+
+    if (missed > 0)
+    {
+        overruns.fetch_add(missed, memory_order_relaxed);
+    }
+    return count;
+}
+
+// ========== LAG ==========
+unsigned long long ChangeFeed::lag(unsigned long long cursor) const
+{
+    unsigned long long head = nextSequence.load(memory_order_acquire);
+    if (cursor == 0)
+    {
+        cursor = 1;
+    }
+    return head > cursor ? head - cursor : 0;
+}
+
+// ========== COUNTERS ==========
+unsigned long long ChangeFeed::getPublished() const
+{
+    return nextSequence.load(memory_order_acquire) - 1;
+}
+
+unsigned long long ChangeFeed::getOverruns() const
+{
+    return overruns.load(memory_order_relaxed);
+}
+
+// ========== DISPLAY CHANGES ==========
+void ChangeFeed::displayChanges(unsigned long long &cursor)
+{
+    logger().flush();
+
+    cout << BOLD << CYAN << "\n+------------- REGISTRY CHANGES ----------+\n"
+         << RESET;
+
+    ChangeRecord changes[DISPLAYED_CHANGES];
+    unsigned long long missed = 0;
+    int count = poll(cursor, changes, DISPLAYED_CHANGES, missed);
+
+    if (missed > 0)
+    {
+        cout << RED << "  [OVERRUN] " << missed << " change(s) dropped - view the registry to resync"
+             << RESET << endl;
+    }
+
+    if (count == 0)
+    {
+        cout << GREEN << "  No changes since the last view\n"
+             << RESET << endl;
+        return;
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        const Aircraft &a = changes[i].aircraft;
+        cout << "  " << setw(6) << changes[i].sequence << " | " << YELLOW << setw(6)
+             << changeTypeName(changes[i].type) << RESET << " | ";
+        if (changes[i].type == CHANGE_RESET)
+        {
+            cout << "registry cleared" << endl;
+            continue;
+        }
+
+        cout << CYAN << setw(10) << flightIDs().getName(a.flightID) << RESET;
+        if (changes[i].type != CHANGE_DELETE)
+        {
+            cout << " | " << aircraftStatusName(static_cast<AircraftStatus>(a.status))
+                 << " | Fuel " << (int)a.fuel << "% | "
+                 << airportNames().getName(a.origin) << " -> " << airportNames().getName(a.destination);
+        }
+        cout << endl;
+    }
+
+    unsigned long long behind = lag(cursor);
+    cout << endl
+         << "  Shown: " << count;
+    if (behind > 0)
+    {
+        cout << " (" << behind << " more - view again)";
+    }
+    cout << endl
+         << endl;
+}
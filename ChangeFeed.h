@@ -0,0 +1,91 @@
+#ifndef CHANGE_FEED_H
+#define CHANGE_FEED_H
+
+#include <atomic>
+#include "HashTable.h"
+
+using namespace std;
+
+// Ring slots (must be a power of two)
+const int CHANGE_FEED_SIZE = 4096;
+
+// ========== CHANGE TYPES ==========
+enum ChangeType
+{
+    CHANGE_INSERT, // new record
+    CHANGE_UPDATE, // insertAircraft over an existing record
+    CHANGE_STATUS,
+    CHANGE_FUEL,
+    CHANGE_DELETE, // only flightID is set
+    CHANGE_RESET   // registry cleared or reloaded; consumers resync
+};
+
+// ========== CHANGE RECORD ==========
+// One registry mutation: its feed sequence and the record as it was
+// after the change
+struct ChangeRecord
+{
+    unsigned long long sequence;
+    ChangeType type;
+    Aircraft aircraft;
+};
+
+// ========== FEED SLOT ==========
+// A record packed into two words, guarded by a version (2 * sequence
+// + 2 once written, odd while being written) so readers on other
+// threads can tell a torn or overwritten slot without locking
+struct FeedSlot
+{
+    atomic<unsigned long long> version;
+    atomic<unsigned long long> words[2];
+};
+
+// ========== CHANGE FEED CLASS ==========
+// Bounded change-data feed of the aircraft registry. The registry
+// publishes every mutation with the next sequence number (1, 2, 3, ...);
+// consumers keep their own cursor (the next sequence they want) and
+// poll for the changes after it, from any thread.
+//
+// Publishing never waits: the ring keeps the newest CHANGE_FEED_SIZE
+// changes and a slow consumer is overrun rather than slowing the
+// writer. poll() reports how many changes a consumer missed, which is
+// its cue to resync from a full registry read and carry on tailing.
+class ChangeFeed
+{
+private:
+    FeedSlot *slots;
+    atomic<unsigned long long> nextSequence; // sequence the next change gets
+    atomic<unsigned long long> overruns;     // changes consumers have missed
+
+public:
+    // Constructor & Destructor
+    ChangeFeed();
+    ~ChangeFeed();
+
+    // Append one change (single writer: the registry that owns the feed)
+    void publish(ChangeType type, const Aircraft &aircraft);
+
+    // Cursor that sees only changes published from now on
+    unsigned long long tail() const;
+
+    // Copy up to maxCount changes from cursor on and advance the cursor.
+    // If some were overwritten before they were read, the cursor jumps
+    // to the oldest one still held and missed says how many were lost.
+    int poll(unsigned long long &cursor, ChangeRecord out[], int maxCount,
+             unsigned long long &missed);
+
+    // Changes a cursor has yet to read (may exceed what the ring holds)
+    unsigned long long lag(unsigned long long cursor) const;
+
+    // Changes published so far, and changes consumers missed
+    unsigned long long getPublished() const;
+    unsigned long long getOverruns() const;
+
+    // Print the changes after an operator's cursor and advance it
+    void displayChanges(unsigned long long &cursor);
+};
+
+// Display name of a change type
+const string &changeTypeName(ChangeType type);
+
+#endif // CHANGE_FEED_H
@@ -0,0 +1,221 @@
+#include "ConcurrentRegistry.h"
+#include <thread>
+#include <cstdlib>
+#include <cstdint>
+#include <new>
+
+using namespace std;
+
+// ========== SHARD LOCK ==========
+void ShardLock::lockShared()
+{
+    for (;;)
+    {
+        if (writersWaiting.load(memory_order_relaxed) == 0)
+        {
+            int current = readers.load(memory_order_relaxed);
+            if (current >= 0 &&
+                readers.compare_exchange_weak(current, current + 1, memory_order_acquire))
+            {
+                return;
+            }
+        }
+        this_thread::yield();
+    }
+}
+
+void ShardLock::unlockShared()
+{
+    readers.fetch_sub(1, memory_order_release);
+}
+
+void ShardLock::lock()
+{
+    writersWaiting.fetch_add(1, memory_order_relaxed);
+
+    int expected = 0;
+    while (!readers.compare_exchange_weak(expected, -1, memory_order_acquire))
+    {
+        expected = 0;
+        this_thread::yield();
+    }
+
+    writersWaiting.fetch_sub(1, memory_order_relaxed);
+}
+
+void ShardLock::unlock()
+{
+    readers.store(0, memory_order_release);
+}
+
+// ========== ALIGNED ALLOCATION ==========
+// Over-allocate and keep the malloc block just before the aligned object
+void *ConcurrentRegistry::operator new(size_t size)
+{
+    size_t alignment = alignof(ConcurrentRegistry);
+    void *block = malloc(size + alignment + sizeof(void *));
+    if (block == NULL)
+    {
+        throw bad_alloc();
+    }
+
+    uintptr_t start = (uintptr_t)block + sizeof(void *);
+    uintptr_t aligned = (start + alignment - 1) & ~(uintptr_t)(alignment - 1);
+    ((void **)aligned)[-1] = block;
+    return (void *)aligned;
+}
+
+void ConcurrentRegistry::operator delete(void *object)
+{
+    if (object != NULL)
+    {
+        free(((void **)object)[-1]);
+    }
+}
+
+// ========== SHARD OF A FLIGHT ==========
+int ConcurrentRegistry::shardOf(FlightHandle flightID)
+{
+    return flightID & (REGISTRY_SHARDS - 1);
+}
+
+// ========== RESOLVE FLIGHT ID ==========
+FlightHandle ConcurrentRegistry::resolve(const string &flightID, bool create)
+{
+    internLock.lockShared();
+    FlightHandle handle = flightIDs().lookup(flightID);
+    internLock.unlockShared();
+
+    if (handle != NO_FLIGHT || !create)
+    {
+        return handle;
+    }
+
+    // New ID: interning may grow the interner, so nobody may read it
+    internLock.lock();
+    handle = flightIDs().intern(flightID);
+    internLock.unlock();
+    return handle;
+}
+
+// ========== KNOWN NAME ==========
+// Empty names encode to 0 without a dictionary entry
+static bool knownName(IDInterner &dictionary, const string &name)
+{
+    return name.empty() || dictionary.lookup(name) != NO_FLIGHT;
+}
+
+// ========== INSERT/UPDATE AIRCRAFT ==========
+void ConcurrentRegistry::insertAircraft(const string &flightID, const string &model, int fuel,
+                                        const string &origin, const string &destination, const string &status)
+{
+    FlightHandle handle = resolve(flightID, true);
+    if (handle == NO_FLIGHT)
+    {
+        return;
+    }
+
+    // Encode before taking the shard, so shard writers never touch the
+    // dictionaries; known names only read them and share the lock
+    Aircraft record;
+    record.flightID = handle;
+
+    internLock.lockShared();
+    bool known = knownName(modelNames(), model) && knownName(airportNames(), origin) &&
+                 knownName(airportNames(), destination);
+    if (known)
+    {
+        HashTable::encodeAircraft(record, model, fuel, origin, destination, status);
+    }
+    internLock.unlockShared();
+
+    if (!known)
+    {
+        internLock.lock();
+        HashTable::encodeAircraft(record, model, fuel, origin, destination, status);
+        internLock.unlock();
+    }
+
+    int shard = shardOf(handle);
+    shardLocks[shard].lock();
+    shards[shard].insertAircraft(record);
+    shardLocks[shard].unlock();
+}
+
+// ========== SEARCH AIRCRAFT ==========
+bool ConcurrentRegistry::searchAircraft(const string &flightID, Aircraft &out)
+{
+    FlightHandle handle = resolve(flightID, false);
+    if (handle == NO_FLIGHT)
+    {
+        return false;
+    }
+
+    int shard = shardOf(handle);
+    shardLocks[shard].lockShared();
+    bool found = shards[shard].copyAircraft(handle, out);
+    shardLocks[shard].unlockShared();
+    return found;
+}
+
+// ========== UPDATE STATUS ==========
+bool ConcurrentRegistry::updateStatus(const string &flightID, const string &newStatus)
+{
+    FlightHandle handle = resolve(flightID, false);
+    if (handle == NO_FLIGHT)
+    {
+        return false;
+    }
+
+    AircraftStatus status = parseAircraftStatus(newStatus);
+    int shard = shardOf(handle);
+    shardLocks[shard].lock();
+    bool updated = shards[shard].updateStatus(handle, status);
+    shardLocks[shard].unlock();
+    return updated;
+}
+
+// ========== UPDATE FUEL ==========
+bool ConcurrentRegistry::updateFuel(const string &flightID, int newFuel)
+{
+    FlightHandle handle = resolve(flightID, false);
+    if (handle == NO_FLIGHT)
+    {
+        return false;
+    }
+
+    int shard = shardOf(handle);
+    shardLocks[shard].lock();
+    bool updated = shards[shard].updateFuel(handle, newFuel);
+    shardLocks[shard].unlock();
+    return updated;
+}
+
+// ========== DELETE AIRCRAFT ==========
+bool ConcurrentRegistry::deleteAircraft(const string &flightID)
+{
+    FlightHandle handle = resolve(flightID, false);
+    if (handle == NO_FLIGHT)
+    {
+        return false;
+    }
+
+    int shard = shardOf(handle);
+    shardLocks[shard].lock();
+    bool deleted = shards[shard].deleteAircraft(handle);
+    shardLocks[shard].unlock();
+    return deleted;
+}
+
+// ========== GET TOTAL AIRCRAFT COUNT ==========
+int ConcurrentRegistry::getTotalAircraft()
+{
+    int total = 0;
+    for (int i = 0; i < REGISTRY_SHARDS; i++)
+    {
+        shardLocks[i].lockShared();
+        total += shards[i].getTotalAircraft();
+        shardLocks[i].unlockShared();
+    }
+    return total;
+}
@@ -0,0 +1,84 @@
+#ifndef CONCURRENT_REGISTRY_H
+#define CONCURRENT_REGISTRY_H
+
+#include <string>
+#include <atomic>
+#include <cstddef>
+#include "HashTable.h"
+
+using namespace std;
+
+const int REGISTRY_SHARDS = 16; // power of two
+
+// ========== SHARD LOCK ==========
+// Reader/writer spin lock. Readers only bump a shared count, so they
+// never wait for each other; a writer waits for the count to drain and
+// holds new readers back meanwhile so it cannot be starved. Aligned to
+// a cache line so neighbouring shards do not share one.
+class alignas(64) ShardLock
+{
+private:
+    atomic<int> readers;        // active readers, -1 while a writer holds it
+    atomic<int> writersWaiting; // writers queued for the lock
+
+public:
+    ShardLock() : readers(0), writersWaiting(0) {}
+
+    void lockShared();
+    void unlockShared();
+    void lock();
+    void unlock();
+};
+
+// ========== CONCURRENT REGISTRY CLASS ==========
+// Aircraft registry that radar ingestion, the simulation tick and
+// operator queries can use from different threads. Records are spread
+// over REGISTRY_SHARDS HashTables by flight handle (handles are dense,
+// so shards fill evenly), each under its own ShardLock: lookups share
+// the lock and copy the record out, updates lock one shard only.
+//
+// The shared ID interner and name dictionaries are guarded by one more
+// ShardLock, taken only while resolving an ID or encoding a record and
+// never together with a shard lock: shards get the handle and encoded
+// record and never read the dictionaries. Only the first insert of a
+// new flight ID, model or airport takes it exclusively. Records here
+// are not journaled - the single-threaded HashTable stays the registry
+// of record for snapshots and replay.
+class ConcurrentRegistry
+{
+private:
+    ShardLock shardLocks[REGISTRY_SHARDS];
+    HashTable shards[REGISTRY_SHARDS];
+    ShardLock internLock;
+
+    // Shard of an interned ID
+    int shardOf(FlightHandle flightID);
+
+    // Handle for an ID under the interner lock (interns if asked)
+    FlightHandle resolve(const string &flightID, bool create);
+
+public:
+    // Heap registries keep the shard locks on cache-line boundaries
+    // (C++11 operator new only aligns to alignof(max_align_t))
+    static void *operator new(size_t size);
+    static void operator delete(void *object);
+
+    // Insert/Update aircraft
+    void insertAircraft(const string &flightID, const string &model, int fuel,
+                        const string &origin, const string &destination, const string &status);
+
+    // Copy of a record; false if the flight is not registered
+    bool searchAircraft(const string &flightID, Aircraft &out);
+
+    // Updates (false if the flight is not registered or the value is invalid)
+    bool updateStatus(const string &flightID, const string &newStatus);
+    bool updateFuel(const string &flightID, int newFuel);
+
+    // Delete aircraft
+    bool deleteAircraft(const string &flightID);
+
+    // Records over all shards (each shard counted under its lock)
+    int getTotalAircraft();
+};
+
+#endif // CONCURRENT_REGISTRY_H
@@ -0,0 +1,317 @@
+#include "ConflictForecaster.h"
+#include "Logger.h"
+#include <iostream>
+#include <iomanip>
+
+using namespace std;
+
+// ========== COLOR CODES ==========
+const string RED = "\033[31m";
+const string GREEN = "\033[32m";
+const string YELLOW = "\033[33m";
+const string CYAN = "\033[36m";
+const string RESET = "\033[0m";
+const string BOLD = "\033[1m";
+
+// Conflicts listed by displayForecast
+const int DISPLAYED_CONFLICTS = 20;
+
+// ========== CONSTRUCTOR ==========
+ConflictForecaster::ConflictForecaster()
+{
+    currentTick = 0;
+    conflictPairs = 0;
+
+    for (int i = 0; i < FORECAST_HORIZON * MAX_NODES; i++)
+    {
+        head[i] = -1;
+        count[i] = 0;
+    }
+    for (int i = 0; i < FORECAST_HORIZON; i++)
+    {
+        conflictCells[i] = 0;
+    }
+
+    entryCell = NULL;
+    next = NULL;
+    prev = NULL;
+    entryCapacity = 0;
+
+    nodeOf = NULL;
+    handleCapacity = 0;
+
+    reserve(64);
+}
+
+// ========== DESTRUCTOR ==========
+ConflictForecaster::~ConflictForecaster()
+{
+    delete[] entryCell;
+    delete[] next;
+    delete[] prev;
+    delete[] nodeOf;
+}
+
+// ========== GROW PER-FLIGHT ARRAYS ==========
+void ConflictForecaster::reserve(int handleCount)
+{
+    if (handleCount <= handleCapacity)
+    {
+        return;
+    }
+
+    int newCapacity = handleCapacity > 0 ? handleCapacity : 64;
+    while (newCapacity < handleCount)
+    {
+        newCapacity *= 2;
+    }
+
+    int *newNodeOf = new int[newCapacity];
+    for (int i = 0; i < newCapacity; i++)
+    {
+        newNodeOf[i] = i < handleCapacity ? nodeOf[i] : -1;
+    }
+
+    // Entry links are indices, so they survive the copy unchanged
+    int newEntryCapacity = newCapacity * FORECAST_HORIZON;
+    int *newEntryCell = new int[newEntryCapacity];
+    int *newNext = new int[newEntryCapacity];
+    int *newPrev = new int[newEntryCapacity];
+    for (int i = 0; i < newEntryCapacity; i++)
+    {
+        bool old = i < entryCapacity;
+        newEntryCell[i] = old ? entryCell[i] : -1;
+        newNext[i] = old ? next[i] : -1;
+        newPrev[i] = old ? prev[i] : -1;
+    }
+
+    delete[] nodeOf;
+    delete[] entryCell;
+    delete[] next;
+    delete[] prev;
+
+    nodeOf = newNodeOf;
+    entryCell = newEntryCell;
+    next = newNext;
+    prev = newPrev;
+    handleCapacity = newCapacity;
+    entryCapacity = newEntryCapacity;
+}
+
+// ========== ADD PREDICTION ==========
+void ConflictForecaster::addEntry(FlightHandle flightID, int tick, int nodeID)
+{
+    if (nodeID < 0 || nodeID >= MAX_NODES)
+    {
+        return;
+    }
+
+    int slot = tick % FORECAST_HORIZON;
+    int entry = (int)flightID * FORECAST_HORIZON + slot;
+    if (entryCell[entry] != -1)
+    {
+        removeEntry(entry);
+    }
+
+    int cell = slot * MAX_NODES + nodeID;
+    entryCell[entry] = cell;
+    prev[entry] = -1;
+    next[entry] = head[cell];
+    if (head[cell] != -1)
+    {
+        prev[head[cell]] = entry;
+    }
+    head[cell] = entry;
+
+    // The new flight conflicts with every flight already in the cell
+    conflictPairs += count[cell];
+    count[cell]++;
+    if (count[cell] == 2)
+    {
+        conflictCells[slot]++;
+    }
+}
+
+// ========== REMOVE PREDICTION ==========
+void ConflictForecaster::removeEntry(int entry)
+{
+    int cell = entryCell[entry];
+
+    if (prev[entry] != -1)
+        next[prev[entry]] = next[entry];
+    else
+        head[cell] = next[entry];
+
+    if (next[entry] != -1)
+        prev[next[entry]] = prev[entry];
+
+    count[cell]--;
+    conflictPairs -= count[cell];
+    if (count[cell] == 1)
+    {
+        conflictCells[cell / MAX_NODES]--;
+    }
+
+    entryCell[entry] = -1;
+    next[entry] = -1;
+    prev[entry] = -1;
+}
+
+// ========== RESET ==========
+void ConflictForecaster::reset(int tick)
+{
+    for (int h = 0; h < handleCapacity; h++)
+    {
+        forget(h);
+    }
+    currentTick = tick;
+}
+
+// ========== ADVANCE ==========
+void ConflictForecaster::advance(int tick)
+{
+    // Every flight stays at its node until it is moved, so the slot of
+    // each tick that passes already holds the new last tick's predictions
+    if (tick > currentTick)
+    {
+        currentTick = tick;
+    }
+}
+
+// ========== REFRESH FLIGHT ==========
+void ConflictForecaster::refresh(FlightHandle flightID, int nodeID)
+{
+    if (flightID == NO_FLIGHT)
+    {
+        return;
+    }
+
+    reserve((int)flightID + 1);
+    if (nodeOf[flightID] == nodeID)
+    {
+        return;
+    }
+
+    // Moved (or new): predict the new node for every tick of the horizon
+    forget(flightID);
+    for (int tick = currentTick; tick < currentTick + FORECAST_HORIZON; tick++)
+    {
+        addEntry(flightID, tick, nodeID);
+    }
+    nodeOf[flightID] = nodeID;
+}
+
+// ========== FORGET FLIGHT ==========
+void ConflictForecaster::forget(FlightHandle flightID)
+{
+    if (flightID == NO_FLIGHT || (int)flightID >= handleCapacity || nodeOf[flightID] < 0)
+    {
+        return;
+    }
+
+    int base = (int)flightID * FORECAST_HORIZON;
+    for (int slot = 0; slot < FORECAST_HORIZON; slot++)
+    {
+        if (entryCell[base + slot] != -1)
+        {
+            removeEntry(base + slot);
+        }
+    }
+    nodeOf[flightID] = -1;
+}
+
+// ========== RESULTS ==========
+long ConflictForecaster::getConflictPairs()
+{
+    return conflictPairs;
+}
+
+int ConflictForecaster::getFirstConflictTick()
+{
+    for (int tick = currentTick; tick < currentTick + FORECAST_HORIZON; tick++)
+    {
+        if (conflictCells[tick % FORECAST_HORIZON] > 0)
+        {
+            return tick;
+        }
+    }
+    return -1;
+}
+
+// ========== LIST CONFLICTS ==========
+int ConflictForecaster::listConflicts(ForecastConflict out[], int maxCount)
+{
+    int written = 0;
+
+    for (int tick = currentTick; tick < currentTick + FORECAST_HORIZON && written < maxCount; tick++)
+    {
+        int slot = tick % FORECAST_HORIZON;
+        if (conflictCells[slot] == 0)
+        {
+            continue;
+        }
+
+        for (int node = 0; node < MAX_NODES && written < maxCount; node++)
+        {
+            int cell = slot * MAX_NODES + node;
+            if (count[cell] < 2)
+            {
+                continue;
+            }
+
+            for (int a = head[cell]; a != -1 && written < maxCount; a = next[a])
+            {
+                for (int b = next[a]; b != -1 && written < maxCount; b = next[b])
+                {
+                    out[written].tick = tick;
+                    out[written].nodeID = node;
+                    out[written].first = a / FORECAST_HORIZON;
+                    out[written].second = b / FORECAST_HORIZON;
+                    written++;
+                }
+            }
+        }
+    }
+
+    return written;
+}
+
+// ========== DISPLAY FORECAST ==========
+void ConflictForecaster::displayForecast(Graph *graph)
+{
+    logger().flush();
+
+    cout << BOLD << CYAN << "\n+=============================================================+\n";
+    cout << "|                " << YELLOW << "CONFLICT FORECAST (" << FORECAST_HORIZON << " TICKS)" << CYAN << "                  |\n";
+    cout << "+=============================================================+\n"
+         << RESET << endl;
+
+    if (conflictPairs == 0)
+    {
+        cout << GREEN << "  No conflicts predicted\n"
+             << RESET << endl;
+        return;
+    }
+
+    cout << "  Conflict Pairs:      " << RED << conflictPairs << RESET << endl;
+    cout << "  First Conflict Tick: " << YELLOW << getFirstConflictTick() << RESET << endl
+         << endl;
+
+    ForecastConflict conflicts[DISPLAYED_CONFLICTS];
+    int shown = listConflicts(conflicts, DISPLAYED_CONFLICTS);
+
+    for (int i = 0; i < shown; i++)
+    {
+        Node *node = graph != NULL ? graph->getNode(conflicts[i].nodeID) : NULL;
+        cout << "  Tick " << setw(6) << conflicts[i].tick << " | "
+             << setw(6) << (node != NULL ? node->name : "?") << " | "
+             << CYAN << flightIDs().getName(conflicts[i].first) << RESET << " <-> "
+             << CYAN << flightIDs().getName(conflicts[i].second) << RESET << endl;
+    }
+
+    if (conflictPairs > shown)
+    {
+        cout << "  ... and " << conflictPairs - shown << " more" << endl;
+    }
+    cout << endl;
+}
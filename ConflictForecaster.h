@@ -0,0 +1,90 @@
+#ifndef CONFLICT_FORECASTER_H
+#define CONFLICT_FORECASTER_H
+
+#include "Graph.h"
+#include "IDInterner.h"
+
+using namespace std;
+
+// Ticks predicted ahead (current tick included)
+const int FORECAST_HORIZON = 16;
+
+// ========== FORECAST CONFLICT ==========
+struct ForecastConflict
+{
+    int tick;
+    int nodeID;
+    FlightHandle first;
+    FlightHandle second;
+
+    ForecastConflict() : tick(-1), nodeID(-1), first(NO_FLIGHT), second(NO_FLIGHT) {}
+};
+
+// ========== CONFLICT FORECASTER CLASS ==========
+// Predicts node conflicts over the next FORECAST_HORIZON ticks. The
+// simulation only moves a flight when it is advanced, diverted or lands,
+// so each flight is predicted to stay at its current node until then.
+// Predictions are kept by absolute tick in a ring of FORECAST_HORIZON
+// slots; each (tick, node) cell holds an intrusive list of the flights
+// expected there and a count, so conflicts are tracked as predictions
+// change instead of being recomputed.
+//
+// Because flights stay put, the slot of a tick that passes already holds
+// the predictions for the tick that enters the horizon, so advancing
+// reuses it as it is and costs nothing per flight. Only the flight that
+// moved has its FORECAST_HORIZON predictions replaced.
+class ConflictForecaster
+{
+private:
+    int currentTick;
+
+    // Cells: ring slot * MAX_NODES + node ID (IDs are 0..MAX_NODES-1)
+    int head[FORECAST_HORIZON * MAX_NODES]; // first entry (-1 = empty)
+    int count[FORECAST_HORIZON * MAX_NODES];
+    int conflictCells[FORECAST_HORIZON];    // cells with 2+ flights per slot
+    long conflictPairs;
+
+    // Entries: handle * FORECAST_HORIZON + ring slot
+    int *entryCell; // -1 when no prediction
+    int *next;
+    int *prev;
+    int entryCapacity;
+
+    // Per handle: node the flight is predicted at (-1 = untracked)
+    int *nodeOf;
+    int handleCapacity;
+
+    void reserve(int handleCount);
+
+    void addEntry(FlightHandle flightID, int tick, int nodeID);
+    void removeEntry(int entry);
+
+public:
+    // Constructor & Destructor
+    ConflictForecaster();
+    ~ConflictForecaster();
+
+    // Forget everything and start predicting from tick
+    void reset(int tick);
+
+    // Move to a later tick; the predictions carry over unchanged
+    void advance(int tick);
+
+    // Predict a flight at its current node for the whole horizon
+    void refresh(FlightHandle flightID, int nodeID);
+
+    // Stop predicting a flight
+    void forget(FlightHandle flightID);
+
+    // Results
+    long getConflictPairs();
+    int getFirstConflictTick(); // -1 when none predicted
+
+    // Conflicting pairs in tick order; returns how many were written
+    int listConflicts(ForecastConflict out[], int maxCount);
+
+    // Print the forecast
+    void displayForecast(Graph *graph);
+};
+
+#endif // CONFLICT_FORECASTER_H
@@ -1,4 +1,6 @@
 #include "FlightManager.h"
+#include "Journal.h"
+#include "Logger.h"
 #include <iostream>
 #include <iomanip>
 #include <algorithm>
@@ -18,51 +20,225 @@ const string BOLD = "\033[1m";
 FlightManager::FlightManager()
 {
     totalFlights = 0;
+    flightCapacity = INITIAL_FLIGHT_CAPACITY;
+    flights = new ActiveFlight[flightCapacity];
     graphPtr = NULL;
     registryPtr = NULL;
-    cout << GREEN << "[SUCCESS] Flight Manager initialized" << RESET << endl;
+    journalPtr = NULL;
+    landingQueuePtr = NULL;
+    currentTick = 0;
+    approachingFlights = 0;
+    clearFreed();
+
+    indexCapacity = 64;
+    indexOfHandle = new int[indexCapacity];
+    occupantNext = new FlightHandle[indexCapacity];
+    occupantPrev = new FlightHandle[indexCapacity];
+    for (int i = 0; i < indexCapacity; i++)
+    {
+        indexOfHandle[i] = -1;
+        occupantNext[i] = NO_FLIGHT;
+        occupantPrev[i] = NO_FLIGHT;
+    }
+    clearOccupants();
+
+    LOG_INFO << GREEN << "[SUCCESS] Flight Manager initialized" << RESET;
 }
 
 // ========== DESTRUCTOR ==========
 FlightManager::~FlightManager()
 {
-    // Nothing special to clean up
+    delete[] flights;
+    delete[] indexOfHandle;
+    delete[] occupantNext;
+    delete[] occupantPrev;
+}
+
+// ========== GROW FLIGHT ARRAY ==========
+void FlightManager::reserveFlights(int count)
+{
+    if (count <= flightCapacity)
+    {
+        return;
+    }
+
+    int newCapacity = flightCapacity;
+    while (newCapacity < count)
+    {
+        newCapacity *= 2;
+    }
+
+    ActiveFlight *newFlights = new ActiveFlight[newCapacity];
+    for (int i = 0; i < totalFlights; i++)
+    {
+        newFlights[i] = flights[i];
+    }
+
+    delete[] flights;
+    flights = newFlights;
+    flightCapacity = newCapacity;
+}
+
+// ========== GROW HANDLE INDEX ==========
+void FlightManager::reserveIndex(int handleCount)
+{
+    if (handleCount <= indexCapacity)
+    {
+        return;
+    }
+
+    int newCapacity = indexCapacity;
+    while (newCapacity < handleCount)
+    {
+        newCapacity *= 2;
+    }
+
+    int *newIndex = new int[newCapacity];
+    FlightHandle *newNext = new FlightHandle[newCapacity];
+    FlightHandle *newPrev = new FlightHandle[newCapacity];
+    for (int i = 0; i < newCapacity; i++)
+    {
+        bool old = i < indexCapacity;
+        newIndex[i] = old ? indexOfHandle[i] : -1;
+        newNext[i] = old ? occupantNext[i] : NO_FLIGHT;
+        newPrev[i] = old ? occupantPrev[i] : NO_FLIGHT;
+    }
+
+    delete[] indexOfHandle;
+    delete[] occupantNext;
+    delete[] occupantPrev;
+    indexOfHandle = newIndex;
+    occupantNext = newNext;
+    occupantPrev = newPrev;
+    indexCapacity = newCapacity;
+}
+
+// ========== SET HANDLE INDEX ==========
+void FlightManager::setIndex(FlightHandle flightID, int index)
+{
+    // Grow the map as new handles are interned
+    reserveIndex((int)flightID + 1);
+    indexOfHandle[flightID] = index;
 }
 
 // ========== SET GRAPH REFERENCE ==========
 void FlightManager::setGraphReference(Graph *g)
 {
     graphPtr = g;
-    cout << GREEN << "[SUCCESS] Graph reference set" << RESET << endl;
+    LOG_INFO << GREEN << "[SUCCESS] Graph reference set" << RESET;
 }
 
 // ========== SET REGISTRY REFERENCE ==========
 void FlightManager::setRegistryReference(HashTable *reg)
 {
     registryPtr = reg;
-    cout << GREEN << "[SUCCESS] Registry reference set" << RESET << endl;
+    LOG_INFO << GREEN << "[SUCCESS] Registry reference set" << RESET;
 }
 
-// ========== ADD FLIGHT ==========
-bool FlightManager::addFlight(string flightID, int startNodeID, int destNodeID,
-                              int priority, string model)
+// ========== SET JOURNAL REFERENCE ==========
+void FlightManager::setJournalReference(Journal *j)
+{
+    journalPtr = j;
+}
+
+// ========== SET LANDING QUEUE REFERENCE ==========
+void FlightManager::setLandingQueueReference(AirportLandingQueues *queue)
 {
-    if (totalFlights >= MAX_ACTIVE_FLIGHTS)
+    landingQueuePtr = queue;
+}
+
+// ========== NEXT LANDING SLOT ==========
+int FlightManager::nextLandingSlot()
+{
+    return currentTick / RUNWAY_SEPARATION_TICKS + 1;
+}
+
+// ========== BOOK RUNWAY SLOT ==========
+void FlightManager::bookRunway(ActiveFlight *flight)
+{
+    int slot = runways.book(flight->flightID, flight->destinationNodeID,
+                            flight->priority, nextLandingSlot());
+    if (slot < 0)
     {
-        cout << RED << "[ERROR]" << RESET << " Maximum active flights reached!" << endl;
-        return false;
+        LOG_WARNING << YELLOW << "[RUNWAY]" << RESET << " No landing slot free for flight " << CYAN
+                    << flightIDs().getName(flight->flightID) << RESET << " - holding";
+        return;
+    }
+
+    LOG_INFO << CYAN << "[RUNWAY]" << RESET << " Flight " << CYAN << flightIDs().getName(flight->flightID)
+             << RESET << " cleared to land at tick " << slot * RUNWAY_SEPARATION_TICKS
+             << " on runway " << runways.getRunway(flight->flightID) + 1;
+}
+
+// ========== QUEUE WAITING FLIGHTS ==========
+void FlightManager::queueWaitingFlights()
+{
+    for (int i = 0; i < totalFlights && sequencedFlights() < approachingFlights; i++)
+    {
+        if (flights[i].status != APPROACHING || runways.getSlot(flights[i].flightID) >= 0)
+        {
+            continue;
+        }
+
+        if (landingQueuePtr == NULL)
+        {
+            bookRunway(&flights[i]);
+        }
+        else if (!landingQueuePtr->contains(flights[i].flightID))
+        {
+            landingQueuePtr->insert(flights[i].flightID, flights[i].destinationNodeID,
+                                    flights[i].priority, currentTick);
+        }
+    }
+}
+
+// ========== SEQUENCED FLIGHTS ==========
+int FlightManager::sequencedFlights()
+{
+    int queued = (landingQueuePtr != NULL) ? landingQueuePtr->getSize() : 0;
+    return runways.getBookedCount() + queued;
+}
+
+// ========== SEQUENCE LANDINGS ==========
+void FlightManager::sequenceLandings()
+{
+    // Flights that lost their slot (or never got one) queue again first
+    if (sequencedFlights() < approachingFlights)
+    {
+        queueWaitingFlights();
     }
 
+    if (landingQueuePtr == NULL)
+    {
+        return;
+    }
+
+    // Most urgent airport's most urgent flight first, so it books the
+    // earliest slot; one that finds no slot is queued again next tick
+    while (!landingQueuePtr->isEmpty())
+    {
+        Flight next = landingQueuePtr->extractMin();
+        ActiveFlight *flight = getFlight(next.flightID);
+        if (flight != NULL)
+        {
+            bookRunway(flight);
+        }
+    }
+}
+
+// ========== VALIDATE NEW FLIGHT ==========
+bool FlightManager::validateNewFlight(const string &flightID, int startNodeID, int destNodeID)
+{
     if (flightExists(flightID))
     {
-        cout << RED << "[ERROR]" << RESET << " Flight " << CYAN << flightID
-             << RESET << " already exists!" << endl;
+        LOG_ERROR << RED << "[ERROR]" << RESET << " Flight " << CYAN << flightID
+                  << RESET << " already exists!";
         return false;
     }
 
     if (graphPtr == NULL)
     {
-        cout << RED << "[ERROR]" << RESET << " Graph reference not set!" << endl;
+        LOG_ERROR << RED << "[ERROR]" << RESET << " Graph reference not set!";
         return false;
     }
 
@@ -72,227 +248,724 @@ bool FlightManager::addFlight(string flightID, int startNodeID, int destNodeID,
 
     if (startNode == NULL || destNode == NULL)
     {
-        cout << RED << "[ERROR]" << RESET << " Invalid node ID!" << endl;
+        LOG_ERROR << RED << "[ERROR]" << RESET << " Invalid node ID!";
+        return false;
+    }
+
+    return true;
+}
+
+// ========== ADD FLIGHT ==========
+bool FlightManager::addFlight(const string &flightID, int startNodeID, int destNodeID,
+                              int priority, const string &model)
+{
+    JournalScope scope(journalPtr);
+
+    if (!validateNewFlight(flightID, startNodeID, destNodeID))
+    {
         return false;
     }
 
+    // Calculate path using Dijkstra
+    int path[MAX_NODES];
+    int pathLength = 0;
+    graphPtr->getPath(startNodeID, destNodeID, path, pathLength);
+
+    if (pathLength == 0)
+    {
+        LOG_ERROR << RED << "[ERROR]" << RESET << " No path exists to destination!";
+        return false;
+    }
+
+    insertFlight(flightID, startNodeID, destNodeID, priority, model, path, pathLength);
+
+    if (scope.recording())
+    {
+        journalPtr->logAddFlight(flightID, startNodeID, destNodeID, priority, model);
+    }
+
+    return true;
+}
+
+// ========== ADD FLIGHT WITH PRECOMPUTED PATH ==========
+bool FlightManager::addPlannedFlight(const string &flightID, int startNodeID, int destNodeID,
+                                     int priority, const string &model,
+                                     const int path[], int pathLength)
+{
+    JournalScope scope(journalPtr);
+
+    if (!validateNewFlight(flightID, startNodeID, destNodeID))
+    {
+        return false;
+    }
+
+    if (pathLength <= 0 || pathLength > MAX_NODES ||
+        path[0] != startNodeID || path[pathLength - 1] != destNodeID)
+    {
+        LOG_ERROR << RED << "[ERROR]" << RESET << " No path exists to destination!";
+        return false;
+    }
+
+    insertFlight(flightID, startNodeID, destNodeID, priority, model, path, pathLength);
+
+    // Replays recompute the same path with Dijkstra
+    if (scope.recording())
+    {
+        journalPtr->logAddFlight(flightID, startNodeID, destNodeID, priority, model);
+    }
+
+    return true;
+}
+
+// ========== INSERT VALIDATED FLIGHT ==========
+void FlightManager::insertFlight(const string &flightID, int startNodeID, int destNodeID,
+                                 int priority, const string &model,
+                                 const int path[], int pathLength)
+{
+    Node *startNode = graphPtr->getNode(startNodeID);
+    Node *destNode = graphPtr->getNode(destNodeID);
+
     // Create flight
     ActiveFlight newFlight;
-    newFlight.flightID = flightID;
+    newFlight.flightID = flightIDs().intern(flightID);
     newFlight.currentNodeID = startNodeID;
     newFlight.destinationNodeID = destNodeID;
     newFlight.priority = priority;
     newFlight.fuel = 100;
+    newFlight.burnRate = fuelBurnRate(model);
     newFlight.status = FLYING;
+    newFlight.pathLength = pathLength;
+    for (int i = 0; i < pathLength; i++)
+    {
+        newFlight.path[i] = path[i];
+    }
 
-    // Calculate path using Dijkstra
-    graphPtr->getPath(startNodeID, destNodeID, newFlight.path, newFlight.pathLength);
+    // Add flight
+    reserveFlights(totalFlights + 1);
+    flights[totalFlights] = newFlight;
+    setIndex(newFlight.flightID, totalFlights);
+
+    // Occupy starting node
+    enterNode(&flights[totalFlights]);
+    totalFlights++;
+    fuelWatch.insert(newFlight.flightID, newFlight.fuel);
+    forecaster.refresh(newFlight.flightID, newFlight.currentNodeID);
+
+    // Add aircraft to registry if registry is available
+    if (registryPtr != NULL)
+    {
+        registryPtr->insertAircraft(flightID, model, 100, startNode->name, destNode->name, "FLYING");
+    }
+
+    LOG_INFO << GREEN << "[ADD]" << RESET << " Flight " << CYAN << flightID
+             << RESET << " added from " << startNode->name << " to " << destNode->name;
+}
+
+// ========== REMOVE FLIGHT ==========
+bool FlightManager::removeFlight(const string &flightID)
+{
+    return removeFlight(flightIDs().lookup(flightID));
+}
+
+bool FlightManager::removeFlight(FlightHandle flightID)
+{
+    JournalScope scope(journalPtr);
+    ActiveFlight *flight = getFlight(flightID);
+
+    if (flight == NULL)
+    {
+        LOG_ERROR << RED << "[ERROR]" << RESET << " Flight not found!";
+        return false;
+    }
+
+    int i = indexOfHandle[flightID];
+
+    // Free the node
+    leaveNode(&flights[i]);
+
+    // Leave the landing sequence
+    if (flights[i].status == APPROACHING)
+    {
+        approachingFlights--;
+    }
+    runways.cancel(flightID);
+    forecaster.forget(flightID);
+    holding.release(flightID);
+    if (landingQueuePtr != NULL)
+    {
+        landingQueuePtr->remove(flightID);
+    }
+
+    // Shift array
+    for (int j = i; j < totalFlights - 1; j++)
+    {
+        flights[j] = flights[j + 1];
+        indexOfHandle[flights[j].flightID] = j;
+    }
+
+    totalFlights--;
+    indexOfHandle[flightID] = -1;
+    fuelWatch.remove(flightID);
+
+    LOG_INFO << GREEN << "[REMOVE]" << RESET << " Flight " << CYAN << flightIDs().getName(flightID)
+             << RESET << " removed";
+
+    if (scope.recording())
+    {
+        journalPtr->logFlightOp(OP_REMOVE_FLIGHT, flightID);
+    }
+    return true;
+}
+
+// ========== GET FLIGHT ==========
+ActiveFlight *FlightManager::getFlight(const string &flightID)
+{
+    return getFlight(flightIDs().lookup(flightID));
+}
+
+ActiveFlight *FlightManager::getFlight(FlightHandle flightID)
+{
+    if (flightID == NO_FLIGHT || (int)flightID >= indexCapacity)
+    {
+        return NULL;
+    }
+
+    int index = indexOfHandle[flightID];
+    if (index < 0)
+    {
+        return NULL;
+    }
+    return &flights[index];
+}
+
+// ========== MOVE FLIGHT TO NEXT NODE (COLLISION DETECTION) ==========
+bool FlightManager::moveFlightToNextNode(const string &flightID)
+{
+    JournalScope scope(journalPtr);
+    ActiveFlight *flight = getFlight(flightID);
+
+    if (flight == NULL)
+    {
+        LOG_ERROR << RED << "[ERROR]" << RESET << " Flight not found!";
+        return false;
+    }
+
+    if (flight->pathIndex >= flight->pathLength - 1)
+    {
+        LOG_INFO << YELLOW << "[INFO]" << RESET << " Flight " << CYAN << flightID
+                 << RESET << " has reached destination!";
+        return false;
+    }
+
+    if (holding.getHoldingNode(flight->flightID) != -1)
+    {
+        LOG_WARNING << YELLOW << "[HOLDING]" << RESET << " Flight " << CYAN << flightID
+                    << RESET << " is already holding for node " << holding.getHoldingNode(flight->flightID);
+        return false;
+    }
+
+    // Get next node in path
+    int nextNodeID = flight->path[flight->pathIndex + 1];
+
+    // CHECK COLLISION - This is Module E!
+    bool occupied = checkCollision(nextNodeID, flight->flightID);
+    if (occupied || holding.getQueueLength(nextNodeID) > 0)
+    {
+        // Wait in the node's queue; the next tick grants it once free
+        if (occupied)
+        {
+            LOG_WARNING << RED << "[ALERT]" << RESET << " Flight " << CYAN << flightID
+                        << RESET << " cannot move - sector occupied!";
+        }
+        else
+        {
+            LOG_WARNING << YELLOW << "[CONTESTED]" << RESET << " Node " << nextNodeID << " already has "
+                        << holding.getQueueLength(nextNodeID) << " flight(s) waiting";
+        }
+
+        holding.hold(flight->flightID, nextNodeID);
+        LOG_WARNING << YELLOW << "[HOLDING]" << RESET << " Flight " << CYAN << flightID
+                    << RESET << " holding for node " << nextNodeID << " ("
+                    << holding.getQueueLength(nextNodeID) << " waiting)";
+
+        if (scope.recording())
+        {
+            journalPtr->logFlightOp(OP_MOVE_FLIGHT, flight->flightID);
+        }
+        return true;
+    }
+
+    advanceFlight(flight);
+
+    if (scope.recording())
+    {
+        journalPtr->logFlightOp(OP_MOVE_FLIGHT, flight->flightID);
+    }
+
+    return true;
+}
+
+// ========== ADVANCE FLIGHT ONE NODE ==========
+void FlightManager::advanceFlight(ActiveFlight *flight)
+{
+    const string &flightID = flightIDs().getName(flight->flightID);
+    int nextNodeID = flight->path[flight->pathIndex + 1];
+
+    // Fuel for this leg depends on its length and the aircraft model
+    int burn = fuelForDistance(graphPtr->getEdgeWeight(flight->currentNodeID, nextNodeID),
+                               flight->burnRate);
+
+    // Free old node
+    leaveNode(flight);
+
+    // Move to next node
+    flight->currentNodeID = nextNodeID;
+    flight->pathIndex++;
+
+    // Occupy new node
+    enterNode(flight);
+
+    // Decrease fuel
+    flight->fuel = max(0, flight->fuel - burn);
+    fuelWatch.update(flight->flightID, flight->fuel);
+    forecaster.refresh(flight->flightID, flight->currentNodeID);
+
+    LOG_INFO << CYAN << "[MOVE]" << RESET << " Flight " << CYAN << flightID
+             << RESET << " moved to node " << nextNodeID
+             << " (Fuel: " << flight->fuel << "%)";
+
+    // Check if reached destination
+    if (flight->pathIndex == flight->pathLength - 1)
+    {
+        flight->status = APPROACHING;
+        LOG_INFO << YELLOW << "[APPROACHING]" << RESET << " Flight " << CYAN << flightID
+                 << RESET << " approaching destination!";
+
+        // Wait in the destination airport's landing queue; the next tick
+        // books runway slots in queue order
+        approachingFlights++;
+        if (landingQueuePtr != NULL)
+        {
+            landingQueuePtr->insert(flight->flightID, flight->destinationNodeID, flight->priority, currentTick);
+        }
+        else
+        {
+            bookRunway(flight);
+        }
+    }
+}
+
+// ========== FUEL MARGIN ==========
+int FlightManager::fuelMargin(ActiveFlight *flight)
+{
+    int distance = 0;
+    for (int i = flight->pathIndex; i < flight->pathLength - 1; i++)
+    {
+        distance += graphPtr->getEdgeWeight(flight->path[i], flight->path[i + 1]);
+    }
+    return flight->fuel - fuelForDistance(distance, flight->burnRate);
+}
+
+// ========== RESOLVE NODE CONTENTION ==========
+int FlightManager::resolveContention()
+{
+    // A winner leaving its node can free another contested node, which
+    // joins the ring and is granted in the same pass
+    int granted = 0;
+    while (freedCount > 0)
+    {
+        int nodeID = freedNodes[freedHead];
+        freedHead = (freedHead + 1) % MAX_NODES;
+        freedCount--;
+        freedPending[nodeID] = false;
+
+        // A flight may have started there since; it is noted again when it leaves
+        if (holding.getQueueLength(nodeID) == 0 || graphPtr->isOccupied(nodeID))
+        {
+            continue;
+        }
+
+        // Most urgent priority, then largest fuel margin; the queue is in
+        // hold order, so strict comparisons leave ties to the earlier hold
+        ActiveFlight *winner = NULL;
+        int winnerMargin = 0;
+        for (FlightHandle h = holding.front(nodeID); h != NO_FLIGHT; h = holding.nextOf(h))
+        {
+            ActiveFlight *candidate = getFlight(h);
+            if (candidate == NULL)
+            {
+                continue;
+            }
+
+            int margin = fuelMargin(candidate);
+            if (winner == NULL || candidate->priority < winner->priority ||
+                (candidate->priority == winner->priority && margin > winnerMargin))
+            {
+                winner = candidate;
+                winnerMargin = margin;
+            }
+        }
+
+        if (winner == NULL)
+        {
+            continue;
+        }
+
+        holding.release(winner->flightID);
+        LOG_INFO << GREEN << "[GRANTED]" << RESET << " Node " << nodeID << " granted to flight "
+                 << CYAN << flightIDs().getName(winner->flightID) << RESET
+                 << " (priority " << winner->priority << ", fuel margin " << winnerMargin << "%, "
+                 << holding.getQueueLength(nodeID) << " still holding)";
+        advanceFlight(winner);
+        granted++;
+    }
+
+    return granted;
+}
+
+// ========== ENTER NODE ==========
+void FlightManager::enterNode(ActiveFlight *flight)
+{
+    graphPtr->occupyNode(flight->currentNodeID, flight->flightID);
+    linkOccupant(flight->flightID, flight->currentNodeID);
+}
+
+void FlightManager::linkOccupant(FlightHandle h, int nodeID)
+{
+    if (nodeID < 0 || nodeID >= MAX_NODES)
+    {
+        return;
+    }
+
+    occupantNext[h] = NO_FLIGHT;
+    occupantPrev[h] = occupantTail[nodeID];
+    if (occupantTail[nodeID] != NO_FLIGHT)
+        occupantNext[occupantTail[nodeID]] = h;
+    else
+        occupantHead[nodeID] = h;
+    occupantTail[nodeID] = h;
+}
+
+// ========== LEAVE NODE ==========
+void FlightManager::leaveNode(ActiveFlight *flight)
+{
+    int nodeID = flight->currentNodeID;
+    FlightHandle h = flight->flightID;
+    Node *node = graphPtr->getNode(nodeID);
+    if (node == NULL)
+    {
+        return;
+    }
+
+    if (occupantPrev[h] != NO_FLIGHT)
+        occupantNext[occupantPrev[h]] = occupantNext[h];
+    else
+        occupantHead[nodeID] = occupantNext[h];
+
+    if (occupantNext[h] != NO_FLIGHT)
+        occupantPrev[occupantNext[h]] = occupantPrev[h];
+    else
+        occupantTail[nodeID] = occupantPrev[h];
+
+    occupantNext[h] = NO_FLIGHT;
+    occupantPrev[h] = NO_FLIGHT;
+
+    // Flights can share their start airport; if this flight is the
+    // occupant shown, the earliest arrival still there takes over
+    FlightHandle stillThere = (node->occupiedBy == h) ? occupantHead[nodeID] : NO_FLIGHT;
+
+    graphPtr->freeNode(nodeID, stillThere);
+    if (!graphPtr->isOccupied(nodeID) && holding.getQueueLength(nodeID) > 0)
+    {
+        noteFreed(nodeID);
+    }
+}
+
+void FlightManager::clearOccupants()
+{
+    for (int i = 0; i < MAX_NODES; i++)
+    {
+        occupantHead[i] = NO_FLIGHT;
+        occupantTail[i] = NO_FLIGHT;
+    }
+}
+
+// ========== NOTE FREED NODE ==========
+void FlightManager::noteFreed(int nodeID)
+{
+    if (nodeID < 0 || nodeID >= MAX_NODES || freedPending[nodeID])
+    {
+        return;
+    }
+
+    freedNodes[(freedHead + freedCount) % MAX_NODES] = nodeID;
+    freedPending[nodeID] = true;
+    freedCount++;
+}
+
+void FlightManager::clearFreed()
+{
+    freedHead = 0;
+    freedCount = 0;
+    for (int i = 0; i < MAX_NODES; i++)
+    {
+        freedPending[i] = false;
+    }
+}
+
+// ========== DECLARE EMERGENCY ==========
+bool FlightManager::declareEmergency(const string &flightID, int newPriority)
+{
+    return declareEmergency(flightIDs().lookup(flightID), newPriority);
+}
+
+bool FlightManager::declareEmergency(FlightHandle flightID, int newPriority)
+{
+    JournalScope scope(journalPtr);
+    ActiveFlight *flight = getFlight(flightID);
+
+    if (flight == NULL)
+    {
+        LOG_ERROR << RED << "[ERROR]" << RESET << " Flight not found!";
+        return false;
+    }
+
+    // The landing queue and runway slots only hold priorities 1-4
+    if (newPriority < 1 || newPriority > LANDING_PRIORITIES)
+    {
+        LOG_ERROR << RED << "[ERROR]" << RESET << " Invalid priority " << newPriority
+                  << " (must be 1-" << LANDING_PRIORITIES << ")";
+        return false;
+    }
+
+    const string &name = flightIDs().getName(flightID);
+    int oldPriority = flight->priority;
+    flight->priority = newPriority;
+
+    string priorityName;
+    if (newPriority == 1)
+        priorityName = "CRITICAL";
+    else if (newPriority == 2)
+        priorityName = "LOW FUEL";
+    else if (newPriority == 3)
+        priorityName = "NORMAL";
+    else
+        priorityName = "LOW";
+
+    LOG_WARNING << RED << "[EMERGENCY]" << RESET << " Flight " << CYAN << name
+                << RESET << " priority changed from " << oldPriority << " to "
+                << newPriority << " (" << priorityName << ")";
 
-    if (newFlight.pathLength == 0)
+    // Re-sequence a flight already waiting to land
+    if (landingQueuePtr != NULL && landingQueuePtr->contains(flight->flightID))
     {
-        cout << RED << "[ERROR]" << RESET << " No path exists to destination!" << endl;
-        return false;
+        landingQueuePtr->updatePriority(flight->flightID, newPriority);
     }
-
-    // Occupy starting node
-    graphPtr->occupyNode(startNodeID, flightID);
-
-    // Add flight
-    flights[totalFlights] = newFlight;
-    totalFlights++;
-
-    // Add aircraft to registry if registry is available
-    if (registryPtr != NULL)
+    if (runways.getSlot(flight->flightID) >= 0 && newPriority != oldPriority)
     {
-        registryPtr->insertAircraft(flightID, model, 100, startNode->name, destNode->name, "FLYING");
+        runways.rebook(flight->flightID, newPriority, nextLandingSlot());
+        LOG_INFO << CYAN << "[RUNWAY]" << RESET << " Flight " << CYAN << name
+                 << RESET << " re-sequenced to land at tick "
+                 << runways.getSlot(flight->flightID) * RUNWAY_SEPARATION_TICKS;
     }
 
-    cout << GREEN << "[ADD]" << RESET << " Flight " << CYAN << flightID
-         << RESET << " added from " << startNode->name << " to " << destNode->name << endl;
+    if (scope.recording())
+    {
+        journalPtr->logFlightValue(OP_SET_PRIORITY, flight->flightID, newPriority);
+    }
 
     return true;
 }
 
-// ========== REMOVE FLIGHT ==========
-bool FlightManager::removeFlight(string flightID)
+// ========== SUBMIT LANDING REQUEST ==========
+bool FlightManager::submitLandingRequest(FlightHandle flightID, int priority)
 {
-    for (int i = 0; i < totalFlights; i++)
+    return intake.push(flightID, priority);
+}
+
+// ========== SEQUENCE LANDING REQUESTS ==========
+int FlightManager::sequenceLandingRequests()
+{
+    LandingRequest batch[INTAKE_BATCH];
+    int applied = 0;
+
+    // One batch per call: with producers pushing steadily the ring may
+    // never empty, so whatever is left waits for the next tick
+    int count = intake.drain(batch, INTAKE_BATCH);
+
+    // Each request is its own journaled priority change, so replay sees
+    // exactly what was applied without knowing about the intake
+    for (int i = 0; i < count; i++)
     {
-        if (flights[i].flightID == flightID)
+        ActiveFlight *flight = getFlight(batch[i].flightID);
+        if (flight == NULL || batch[i].priority < 1 || batch[i].priority > LANDING_PRIORITIES)
         {
-            // Free the node
-            graphPtr->freeNode(flights[i].currentNodeID);
-
-            // Shift array
-            for (int j = i; j < totalFlights - 1; j++)
-            {
-                flights[j] = flights[j + 1];
-            }
+            LOG_WARNING << YELLOW << "[INTAKE]" << RESET << " Dropped landing request for "
+                        << CYAN << flightIDs().getName(batch[i].flightID) << RESET;
+            continue;
+        }
 
-            totalFlights--;
-            cout << GREEN << "[REMOVE]" << RESET << " Flight " << CYAN << flightID
-                 << RESET << " removed" << endl;
-            return true;
+        if (flight->priority != batch[i].priority &&
+            declareEmergency(batch[i].flightID, batch[i].priority))
+        {
+            applied++;
         }
     }
 
-    cout << RED << "[ERROR]" << RESET << " Flight not found!" << endl;
-    return false;
+    if (applied > 0)
+    {
+        LOG_INFO << CYAN << "[INTAKE]" << RESET << " " << applied << " landing request(s) sequenced";
+    }
+
+    return applied;
 }
 
-// ========== GET FLIGHT ==========
-ActiveFlight *FlightManager::getFlight(string flightID)
+// ========== PENDING LANDING REQUESTS ==========
+size_t FlightManager::getPendingLandingRequests()
 {
-    for (int i = 0; i < totalFlights; i++)
-    {
-        if (flights[i].flightID == flightID)
-        {
-            return &flights[i];
-        }
-    }
-    return NULL;
+    return intake.getPending();
 }
 
-// ========== MOVE FLIGHT TO NEXT NODE (COLLISION DETECTION) ==========
-bool FlightManager::moveFlightToNextNode(string flightID)
+// ========== DIVERT FLIGHT ==========
+bool FlightManager::divertFlight(const string &flightID, int newDestNodeID)
 {
+    JournalScope scope(journalPtr);
     ActiveFlight *flight = getFlight(flightID);
 
     if (flight == NULL)
     {
-        cout << RED << "[ERROR]" << RESET << " Flight not found!" << endl;
+        LOG_ERROR << RED << "[ERROR]" << RESET << " Flight not found!";
         return false;
     }
 
-    if (flight->pathIndex >= flight->pathLength - 1)
+    Node *destNode = graphPtr->getNode(newDestNodeID);
+    if (destNode == NULL || destNode->type != AIRPORT)
     {
-        cout << YELLOW << "[INFO]" << RESET << " Flight " << CYAN << flightID
-             << RESET << " has reached destination!" << endl;
+        LOG_ERROR << RED << "[ERROR]" << RESET << " Flights can only be diverted to an airport!";
         return false;
     }
 
-    // Get next node in path
-    int nextNodeID = flight->path[flight->pathIndex + 1];
-
-    // CHECK COLLISION - This is Module E!
-    if (checkCollision(nextNodeID, flightID))
+    if (newDestNodeID == flight->destinationNodeID || newDestNodeID == flight->currentNodeID)
     {
-        cout << RED << "[ALERT]" << RESET << " Flight " << CYAN << flightID
-             << RESET << " cannot move - sector occupied!" << endl;
-        cout << RED << "[COLLISION]" << RESET << " Holding flight at current position" << endl;
+        LOG_ERROR << RED << "[ERROR]" << RESET << " Flight " << CYAN << flightID
+                  << RESET << " is already bound for or at " << destNode->name;
         return false;
     }
 
-    // Free old node
-    graphPtr->freeNode(flight->currentNodeID);
-
-    // Move to next node
-    flight->currentNodeID = nextNodeID;
-    flight->pathIndex++;
-
-    // Occupy new node
-    graphPtr->occupyNode(nextNodeID, flightID);
-
-    // Decrease fuel
-    flight->fuel = max(0, flight->fuel - 1);
-
-    cout << CYAN << "[MOVE]" << RESET << " Flight " << CYAN << flightID
-         << RESET << " moved to node " << nextNodeID
-         << " (Fuel: " << flight->fuel << "%)" << endl;
-
-    // Check if reached destination
-    if (flight->pathIndex == flight->pathLength - 1)
+    int path[MAX_NODES];
+    int pathLength = 0;
+    graphPtr->getPath(flight->currentNodeID, newDestNodeID, path, pathLength);
+    if (pathLength < 2)
     {
-        flight->status = APPROACHING;
-        cout << YELLOW << "[APPROACHING]" << RESET << " Flight " << CYAN << flightID
-             << RESET << " approaching destination!" << endl;
+        LOG_ERROR << RED << "[ERROR]" << RESET << " No path exists to " << destNode->name << "!";
+        return false;
     }
 
-    return true;
-}
+    // Leave the landing sequence; the queue's position map finds the
+    // flight directly, so this is O(log n) however long the queue is
+    if (flight->status == APPROACHING)
+    {
+        approachingFlights--;
+        flight->status = FLYING;
+    }
+    if (landingQueuePtr != NULL)
+    {
+        landingQueuePtr->remove(flight->flightID);
+    }
+    runways.cancel(flight->flightID);
 
-// ========== DECLARE EMERGENCY ==========
-bool FlightManager::declareEmergency(string flightID, int newPriority)
-{
-    ActiveFlight *flight = getFlight(flightID);
+    // The old next node may no longer be on the route
+    holding.release(flight->flightID);
 
-    if (flight == NULL)
+    flight->destinationNodeID = newDestNodeID;
+    flight->pathIndex = 0;
+    flight->pathLength = pathLength;
+    for (int i = 0; i < pathLength; i++)
     {
-        cout << RED << "[ERROR]" << RESET << " Flight not found!" << endl;
-        return false;
+        flight->path[i] = path[i];
     }
+    forecaster.refresh(flight->flightID, flight->currentNodeID);
 
-    int oldPriority = flight->priority;
-    flight->priority = newPriority;
+    // Keep the registry record's destination in step
+    Aircraft record;
+    if (registryPtr != NULL && registryPtr->copyAircraft(flight->flightID, record))
+    {
+        registryPtr->insertAircraft(flightID, modelNames().getName(record.model), record.fuel,
+                                    airportNames().getName(record.origin), destNode->name,
+                                    aircraftStatusName(static_cast<AircraftStatus>(record.status)));
+    }
 
-    string priorityName;
-    if (newPriority == 1)
-        priorityName = "CRITICAL";
-    else if (newPriority == 2)
-        priorityName = "LOW FUEL";
-    else if (newPriority == 3)
-        priorityName = "NORMAL";
-    else
-        priorityName = "LOW";
+    LOG_WARNING << YELLOW << "[DIVERT]" << RESET << " Flight " << CYAN << flightID
+                << RESET << " diverted to " << destNode->name << " (" << pathLength - 1 << " leg(s))";
 
-    cout << RED << "[EMERGENCY]" << RESET << " Flight " << CYAN << flightID
-         << RESET << " priority changed from " << oldPriority << " to "
-         << newPriority << " (" << priorityName << ")" << endl;
+    if (scope.recording())
+    {
+        journalPtr->logFlightValue(OP_DIVERT_FLIGHT, flight->flightID, newDestNodeID);
+    }
 
     return true;
 }
 
 // ========== UPDATE FUEL ==========
-bool FlightManager::updateFuel(string flightID, int newFuel)
+bool FlightManager::updateFuel(const string &flightID, int newFuel)
 {
+    JournalScope scope(journalPtr);
     ActiveFlight *flight = getFlight(flightID);
 
     if (flight == NULL)
     {
-        cout << RED << "[ERROR]" << RESET << " Flight not found!" << endl;
+        LOG_ERROR << RED << "[ERROR]" << RESET << " Flight not found!";
         return false;
     }
 
     if (newFuel < 0 || newFuel > 100)
     {
-        cout << RED << "[ERROR]" << RESET << " Invalid fuel value!" << endl;
+        LOG_ERROR << RED << "[ERROR]" << RESET << " Invalid fuel value!";
         return false;
     }
 
     flight->fuel = newFuel;
+    fuelWatch.update(flight->flightID, newFuel);
 
     if (newFuel < 10)
     {
-        cout << RED << "[ALERT]" << RESET << " Flight " << CYAN << flightID
-             << RESET << " LOW FUEL: " << newFuel << "%" << endl;
+        LOG_WARNING << RED << "[ALERT]" << RESET << " Flight " << CYAN << flightID
+                    << RESET << " LOW FUEL: " << newFuel << "%";
     }
     else
     {
-        cout << YELLOW << "[UPDATE]" << RESET << " Flight fuel updated to "
-             << newFuel << "%" << endl;
+        LOG_INFO << YELLOW << "[UPDATE]" << RESET << " Flight fuel updated to "
+                 << newFuel << "%";
+    }
+
+    if (scope.recording())
+    {
+        journalPtr->logFlightValue(OP_UPDATE_FUEL, flight->flightID, newFuel);
     }
 
     return true;
 }
 
 // ========== LAND FLIGHT ==========
-bool FlightManager::landFlight(string flightID)
+bool FlightManager::landFlight(const string &flightID)
 {
+    JournalScope scope(journalPtr);
     ActiveFlight *flight = getFlight(flightID);
 
     if (flight == NULL)
     {
-        cout << RED << "[ERROR]" << RESET << " Flight not found!" << endl;
+        LOG_ERROR << RED << "[ERROR]" << RESET << " Flight not found!";
         return false;
     }
 
     if (flight->status != APPROACHING)
     {
-        cout << RED << "[ERROR]" << RESET << " Flight must be approaching to land!" << endl;
+        LOG_ERROR << RED << "[ERROR]" << RESET << " Flight must be approaching to land!";
         return false;
     }
 
     flight->status = LANDED;
+    approachingFlights--;
 
     // Update registry status if available
     if (registryPtr != NULL)
@@ -300,15 +973,119 @@ bool FlightManager::landFlight(string flightID)
         registryPtr->updateStatus(flightID, "LANDED");
     }
 
-    cout << GREEN << "[LANDED]" << RESET << " Flight " << CYAN << flightID
-         << RESET << " has successfully landed!" << endl;
+    LOG_INFO << GREEN << "[LANDED]" << RESET << " Flight " << CYAN << flightID
+             << RESET << " has successfully landed!";
 
-    removeFlight(flightID);
+    FlightHandle handle = flight->flightID;
+    removeFlight(handle);
+
+    if (scope.recording())
+    {
+        journalPtr->logFlightOp(OP_LAND_FLIGHT, handle);
+    }
     return true;
 }
 
+// ========== SIMULATION TICK ==========
+int FlightManager::tick()
+{
+    JournalScope scope(journalPtr);
+    currentTick++;
+    forecaster.advance(currentTick);
+
+    // Visit only flights below the threshold (fuel levels 0..threshold-1)
+    int escalated = 0;
+    for (int fuel = 0; fuel < LOW_FUEL_THRESHOLD; fuel++)
+    {
+        for (FlightHandle h = fuelWatch.first(fuel); h != NO_FLIGHT; h = fuelWatch.nextOf(h))
+        {
+            ActiveFlight *flight = getFlight(h);
+            if (flight != NULL && flight->priority > 2)
+            {
+                declareEmergency(h, 2);
+                escalated++;
+            }
+        }
+    }
+
+    int landed = releaseLandings();
+    int granted = resolveContention();
+
+    LOG_INFO << CYAN << "[TICK]" << RESET << " Tick " << currentTick << ": "
+             << escalated << " flight(s) escalated to LOW FUEL, "
+             << landed << " landing(s) released, "
+             << granted << " contested node(s) granted";
+
+    if (forecaster.getConflictPairs() > 0)
+    {
+        LOG_WARNING << RED << "[FORECAST]" << RESET << " " << forecaster.getConflictPairs()
+                    << " conflict(s) predicted, first at tick " << forecaster.getFirstConflictTick();
+    }
+
+    if (scope.recording())
+    {
+        journalPtr->logTick();
+    }
+
+    return escalated;
+}
+
+// ========== RELEASE LANDINGS ==========
+int FlightManager::releaseLandings()
+{
+    sequenceLandings();
+
+    FlightHandle due[MAX_NODES * DEFAULT_RUNWAYS];
+    int count = runways.collectDue(currentTick / RUNWAY_SEPARATION_TICKS, due,
+                                   MAX_NODES * DEFAULT_RUNWAYS);
+
+    int landed = 0;
+    for (int i = 0; i < count; i++)
+    {
+        if (landFlight(flightIDs().getName(due[i])))
+        {
+            landed++;
+        }
+        else
+        {
+            runways.cancel(due[i]);
+        }
+    }
+
+    return landed;
+}
+
+// ========== CONFLICT FORECAST ==========
+void FlightManager::refreshForecast()
+{
+    for (int i = 0; i < totalFlights; i++)
+    {
+        forecaster.refresh(flights[i].flightID, flights[i].currentNodeID);
+    }
+}
+
+long FlightManager::getPredictedConflicts()
+{
+    return forecaster.getConflictPairs();
+}
+
+int FlightManager::getFirstConflictTick()
+{
+    return forecaster.getFirstConflictTick();
+}
+
+int FlightManager::getCurrentTick()
+{
+    return currentTick;
+}
+
+int FlightManager::countLowFuel(int threshold)
+{
+    return fuelWatch.countBelow(threshold);
+}
+
 // ========== GET FLIGHT STATUS ==========
-FlightStatus FlightManager::getFlightStatus(string flightID)
+FlightStatus FlightManager::getFlightStatus(const string &flightID)
 {
     ActiveFlight *flight = getFlight(flightID);
     if (flight != NULL)
@@ -321,6 +1098,8 @@ FlightStatus FlightManager::getFlightStatus(string flightID)
 // ========== DISPLAY ALL ACTIVE FLIGHTS ==========
 void FlightManager::displayAllActiveFlights()
 {
+    logger().flush();
+
     cout << BOLD << CYAN;
     cout << "\n+=============================================================+\n";
     cout << "|              " << YELLOW << "ACTIVE FLIGHTS" << CYAN << "                            |\n";
@@ -342,12 +1121,14 @@ void FlightManager::displayAllActiveFlights()
     for (int i = 0; i < totalFlights; i++)
     {
         cout << BOLD << "  " << (i + 1) << ". " << RESET;
-        cout << CYAN << setw(12) << flights[i].flightID << RESET << " | ";
+        cout << CYAN << setw(12) << flightIDs().getName(flights[i].flightID) << RESET << " | ";
         cout << GREEN << setw(10) << flights[i].currentNodeID << RESET << " | ";
         cout << YELLOW << "Fuel: " << setw(3) << flights[i].fuel << "% " << RESET << "| ";
 
         string status;
-        if (flights[i].status == FLYING)
+        if (holding.getHoldingNode(flights[i].flightID) != -1)
+            status = "HOLDING";
+        else if (flights[i].status == FLYING)
             status = "FLYING";
         else if (flights[i].status == APPROACHING)
             status = "APPROACHING";
@@ -363,8 +1144,10 @@ void FlightManager::displayAllActiveFlights()
 }
 
 // ========== DISPLAY FLIGHT DETAILS ==========
-void FlightManager::displayFlightDetails(string flightID)
+void FlightManager::displayFlightDetails(const string &flightID)
 {
+    logger().flush();
+
     ActiveFlight *flight = getFlight(flightID);
 
     if (flight == NULL)
@@ -376,11 +1159,23 @@ void FlightManager::displayFlightDetails(string flightID)
     cout << BOLD << CYAN << "\n+------------- FLIGHT DETAILS ----------+\n"
          << RESET;
 
-    cout << "  " << BOLD << "Flight ID: " << RESET << CYAN << flight->flightID << RESET << endl;
+    cout << "  " << BOLD << "Flight ID: " << RESET << CYAN << flightIDs().getName(flight->flightID) << RESET << endl;
     cout << "  " << BOLD << "Current Node: " << RESET << flight->currentNodeID << endl;
     cout << "  " << BOLD << "Destination Node: " << RESET << flight->destinationNodeID << endl;
     cout << "  " << BOLD << "Priority: " << RESET << flight->priority << endl;
     cout << "  " << BOLD << "Fuel: " << RESET << YELLOW << flight->fuel << "%" << RESET << endl;
+    cout << "  " << BOLD << "Burn Rate: " << RESET << flight->burnRate << "% per 1000 km" << endl;
+    if (runways.getSlot(flight->flightID) >= 0)
+    {
+        cout << "  " << BOLD << "Landing Slot: " << RESET << "tick "
+             << runways.getSlot(flight->flightID) * RUNWAY_SEPARATION_TICKS
+             << ", runway " << runways.getRunway(flight->flightID) + 1 << endl;
+    }
+    if (holding.getHoldingNode(flight->flightID) != -1)
+    {
+        cout << "  " << BOLD << "Holding For: " << RESET << YELLOW << "node "
+             << holding.getHoldingNode(flight->flightID) << RESET << endl;
+    }
     cout << "  " << BOLD << "Path Progress: " << RESET << flight->pathIndex + 1 << "/" << flight->pathLength << endl;
 
     cout << BOLD << CYAN << "+----------------------------------------+\n"
@@ -388,8 +1183,10 @@ void FlightManager::displayFlightDetails(string flightID)
 }
 
 // ========== DISPLAY FLIGHT PATH ==========
-void FlightManager::displayFlightPath(string flightID)
+void FlightManager::displayFlightPath(const string &flightID)
 {
+    logger().flush();
+
     ActiveFlight *flight = getFlight(flightID);
 
     if (flight == NULL)
@@ -415,6 +1212,29 @@ void FlightManager::displayFlightPath(string flightID)
          << RESET << endl;
 }
 
+// ========== DISPLAY RUNWAY SCHEDULE ==========
+void FlightManager::displayRunwaySchedule()
+{
+    runways.displaySchedule(graphPtr, currentTick / RUNWAY_SEPARATION_TICKS);
+}
+
+// ========== DISPLAY CONFLICT FORECAST ==========
+void FlightManager::displayConflictForecast()
+{
+    forecaster.displayForecast(graphPtr);
+}
+
+// ========== DISPLAY HOLDING QUEUES ==========
+void FlightManager::displayHoldingQueues()
+{
+    holding.displayQueues(graphPtr);
+}
+
+int FlightManager::getHoldingFlights()
+{
+    return holding.getHoldingCount();
+}
+
 // ========== GET TOTAL FLIGHTS ==========
 int FlightManager::getTotalFlights()
 {
@@ -432,13 +1252,13 @@ ActiveFlight *FlightManager::getFlightByIndex(int index)
 }
 
 // ========== CHECK IF FLIGHT EXISTS ==========
-bool FlightManager::flightExists(string flightID)
+bool FlightManager::flightExists(const string &flightID)
 {
     return getFlight(flightID) != NULL;
 }
 
 // ========== GET FLIGHT NODE ID ==========
-int FlightManager::getFlightNodeID(string flightID)
+int FlightManager::getFlightNodeID(const string &flightID)
 {
     ActiveFlight *flight = getFlight(flightID);
     if (flight != NULL)
@@ -449,7 +1269,12 @@ int FlightManager::getFlightNodeID(string flightID)
 }
 
 // ========== CHECK COLLISION (MODULE E IMPLEMENTATION) ==========
-bool FlightManager::checkCollision(int nodeID, string excludeFlightID)
+bool FlightManager::checkCollision(int nodeID, const string &excludeFlightID)
+{
+    return checkCollision(nodeID, flightIDs().lookup(excludeFlightID));
+}
+
+bool FlightManager::checkCollision(int nodeID, FlightHandle excludeFlightID)
 {
     for (int i = 0; i < totalFlights; i++)
     {
@@ -463,13 +1288,13 @@ bool FlightManager::checkCollision(int nodeID, string excludeFlightID)
 }
 
 // ========== SAVE TO FILE ==========
-void FlightManager::saveToFile(string filename)
+void FlightManager::saveToFile(const string &filename)
 {
     ofstream file(filename.c_str());
 
     if (!file.is_open())
     {
-        cout << RED << "[ERROR]" << RESET << " Could not open file for saving!" << endl;
+        LOG_ERROR << RED << "[ERROR]" << RESET << " Could not open file for saving!";
         return;
     }
 
@@ -477,7 +1302,7 @@ void FlightManager::saveToFile(string filename)
 
     for (int i = 0; i < totalFlights; i++)
     {
-        file << flights[i].flightID << endl;
+        file << flightIDs().getName(flights[i].flightID) << endl;
         file << flights[i].currentNodeID << endl;
         file << flights[i].destinationNodeID << endl;
         file << flights[i].priority << endl;
@@ -494,26 +1319,49 @@ void FlightManager::saveToFile(string filename)
     }
 
     file.close();
-    cout << GREEN << "[SUCCESS]" << RESET << " Flight data saved to " << filename << endl;
+    LOG_INFO << GREEN << "[SUCCESS]" << RESET << " Flight data saved to " << filename;
 }
 
 // ========== LOAD FROM FILE ==========
-void FlightManager::loadFromFile(string filename)
+void FlightManager::loadFromFile(const string &filename)
 {
     ifstream file(filename.c_str());
 
     if (!file.is_open())
     {
-        cout << RED << "[ERROR]" << RESET << " Could not open file for loading!" << endl;
+        LOG_ERROR << RED << "[ERROR]" << RESET << " Could not open file for loading!";
         return;
     }
 
+    // Drop the handle index and queue entries of any flights being replaced
+    for (int i = 0; i < totalFlights; i++)
+    {
+        indexOfHandle[flights[i].flightID] = -1;
+        if (landingQueuePtr != NULL)
+        {
+            landingQueuePtr->remove(flights[i].flightID);
+        }
+    }
+
+    // Release nodes held by the flights being replaced
+    if (graphPtr != NULL)
+    {
+        for (int i = 0; i < totalFlights; i++)
+        {
+            leaveNode(&flights[i]);
+        }
+    }
+
     file >> totalFlights;
     file.ignore();
+    reserveFlights(totalFlights);
 
     for (int i = 0; i < totalFlights; i++)
     {
-        getline(file, flights[i].flightID);
+        string flightID;
+        getline(file, flightID);
+        flights[i].flightID = flightIDs().intern(flightID);
+        setIndex(flights[i].flightID, i);
         file >> flights[i].currentNodeID;
         file >> flights[i].destinationNodeID;
         file >> flights[i].priority;
@@ -531,9 +1379,215 @@ void FlightManager::loadFromFile(string filename)
             file >> flights[i].path[j];
         }
         file.ignore();
+
+        // Restore node occupancy
+        if (graphPtr != NULL)
+        {
+            enterNode(&flights[i]);
+        }
     }
 
     file.close();
-    cout << GREEN << "[SUCCESS]" << RESET << " Flight data loaded from " << filename << endl;
-    cout << CYAN << "[INFO]" << RESET << " Loaded " << totalFlights << " active flights" << endl;
-}
\ No newline at end of file
+
+    // The text format has no model, so flights use the default burn rate
+    fuelWatch.clear();
+    for (int i = 0; i < totalFlights; i++)
+    {
+        flights[i].burnRate = DEFAULT_BURN_RATE;
+        fuelWatch.insert(flights[i].flightID, flights[i].fuel);
+
+        if (flights[i].status == APPROACHING && landingQueuePtr != NULL)
+        {
+            landingQueuePtr->insert(flights[i].flightID, flights[i].destinationNodeID,
+                                    flights[i].priority, currentTick);
+        }
+    }
+
+    forecaster.reset(currentTick);
+    refreshForecast();
+
+    // Holds are not stored in the text format; held flights stay put
+    holding.clear();
+    clearFreed();
+
+    // Slots are not stored in the text format; approaching flights are
+    // queued above and book again on the next tick
+    runways.clear();
+    approachingFlights = 0;
+    for (int i = 0; i < totalFlights; i++)
+    {
+        if (flights[i].status == APPROACHING)
+        {
+            approachingFlights++;
+            if (landingQueuePtr == NULL)
+            {
+                bookRunway(&flights[i]);
+            }
+        }
+    }
+
+    LOG_INFO << GREEN << "[SUCCESS]" << RESET << " Flight data loaded from " << filename;
+    LOG_INFO << CYAN << "[INFO]" << RESET << " Loaded " << totalFlights << " active flights";
+}
+
+// ========== SAVE BINARY SECTION ==========
+void FlightManager::saveBinary(BinaryWriter &out)
+{
+    out.writeI32(currentTick);
+    out.writeI32(totalFlights);
+
+    for (int i = 0; i < totalFlights; i++)
+    {
+        ActiveFlight &f = flights[i];
+        out.writeU32(f.flightID);
+        out.writeI32(f.currentNodeID);
+        out.writeI32(f.destinationNodeID);
+        out.writeI32(f.priority);
+        out.writeI32(f.fuel);
+        out.writeI32(f.burnRate);
+        out.writeI32(runways.getSlot(f.flightID));
+        out.writeI32(runways.getRunway(f.flightID));
+        out.writeI32(f.status);
+        out.writeI32(f.pathIndex);
+        out.writeI32(f.pathLength);
+        out.writeBytes(f.path, sizeof(int) * f.pathLength);
+    }
+
+    holding.saveBinary(out);
+}
+
+// ========== STATE CHECKSUM ==========
+unsigned int FlightManager::stateChecksum()
+{
+    BinaryWriter out;
+    out.writeI32(currentTick);
+    out.writeI32(totalFlights);
+
+    for (int i = 0; i < totalFlights; i++)
+    {
+        ActiveFlight &f = flights[i];
+        out.writeString(flightIDs().getName(f.flightID));
+        out.writeI32(f.currentNodeID);
+        out.writeI32(f.destinationNodeID);
+        out.writeI32(f.priority);
+        out.writeI32(f.fuel);
+        out.writeI32(f.burnRate);
+        out.writeI32(runways.getSlot(f.flightID));
+        out.writeI32(runways.getRunway(f.flightID));
+        out.writeI32(f.status);
+        out.writeI32(f.pathIndex);
+        out.writeI32(f.pathLength);
+        out.writeBytes(f.path, sizeof(int) * f.pathLength);
+    }
+    holding.writeState(out);
+
+    return checksumBytes(out.getData(), out.getSize());
+}
+
+// ========== LOAD BINARY SECTION ==========
+bool FlightManager::loadBinary(BinaryReader &in, const HandleRemap &remap)
+{
+    int tick = in.readI32();
+    int count = in.readI32();
+    if (!in.ok() || count < 0)
+    {
+        return false;
+    }
+
+    // Forget the handle index of any flights being replaced
+    for (int i = 0; i < totalFlights; i++)
+    {
+        indexOfHandle[flights[i].flightID] = -1;
+    }
+
+    // Size both arrays once instead of growing per flight
+    totalFlights = 0;
+    currentTick = tick;
+    approachingFlights = 0;
+    fuelWatch.clear();
+    runways.clear();
+    reserveFlights(count);
+    reserveIndex(flightIDs().getCount() + 1);
+
+    for (int i = 0; i < count; i++)
+    {
+        ActiveFlight &f = flights[i];
+        f.flightID = remap.map(in.readU32());
+        f.currentNodeID = in.readI32();
+        f.destinationNodeID = in.readI32();
+        f.priority = in.readI32();
+        f.fuel = in.readI32();
+        f.burnRate = in.readI32();
+        int slot = in.readI32();
+        int runway = in.readI32();
+        f.status = static_cast<FlightStatus>(in.readI32());
+        f.pathIndex = in.readI32();
+        f.pathLength = in.readI32();
+
+        if (f.pathLength < 0 || f.pathLength > MAX_NODES)
+        {
+            in.fail();
+        }
+        if (!in.ok())
+        {
+            return false;
+        }
+
+        in.readBytes(f.path, sizeof(int) * f.pathLength);
+        indexOfHandle[f.flightID] = i;
+        fuelWatch.insert(f.flightID, f.fuel);
+        if (f.status == APPROACHING)
+        {
+            approachingFlights++;
+        }
+        if (slot >= 0 && !runways.restore(f.flightID, f.destinationNodeID, slot, runway, f.priority))
+        {
+            return false;
+        }
+        totalFlights++;
+    }
+
+    if (!holding.loadBinary(in, remap))
+    {
+        return false;
+    }
+
+    // The graph section stores one occupant per node; rebuild each
+    // node's list with that occupant first, count the flights sharing a
+    // node, and note contested nodes that are free for the next tick
+    clearFreed();
+    clearOccupants();
+    if (graphPtr != NULL)
+    {
+        for (int i = 0; i < totalFlights; i++)
+        {
+            if (graphPtr->getOccupant(flights[i].currentNodeID) == flights[i].flightID)
+            {
+                linkOccupant(flights[i].flightID, flights[i].currentNodeID);
+            }
+        }
+        for (int i = 0; i < totalFlights; i++)
+        {
+            if (graphPtr->getOccupant(flights[i].currentNodeID) != flights[i].flightID)
+            {
+                enterNode(&flights[i]);
+            }
+        }
+
+        int contested[MAX_NODES];
+        int contestedCount = holding.listContested(contested, MAX_NODES);
+        for (int i = 0; i < contestedCount; i++)
+        {
+            if (!graphPtr->isOccupied(contested[i]))
+            {
+                noteFreed(contested[i]);
+            }
+        }
+    }
+
+    forecaster.reset(currentTick);
+    refreshForecast();
+
+    // Node occupancy is restored with the graph section
+    return in.ok();
+}
@@ -5,10 +5,19 @@
 #include <iostream>
 #include "Graph.h"
 #include "HashTable.h"
+#include "FuelWatch.h"
+#include "AirportLandingQueues.h"
+#include "LandingIntake.h"
+#include "RunwayScheduler.h"
+#include "ConflictForecaster.h"
+#include "HoldingQueues.h"
+#include "BinaryIO.h"
 
 using namespace std;
 
-const int MAX_ACTIVE_FLIGHTS = 20;
+class Journal;
+
+const int INITIAL_FLIGHT_CAPACITY = 20; // grows on demand
 
 // ========== FLIGHT STATUS ENUM ==========
 enum FlightStatus
@@ -25,18 +34,19 @@ enum FlightStatus
 // ========== ACTIVE FLIGHT STRUCTURE ==========
 struct ActiveFlight
 {
-    string flightID;
+    FlightHandle flightID; // interned flight ID
     int currentNodeID;
     int destinationNodeID;
     int priority; // 1=Critical, 2=Low Fuel, 3=Normal, 4=Low
     int fuel;     // 0-100%
+    int burnRate; // fuel % per 1000 km (see fuelBurnRate)
     FlightStatus status;
     int pathIndex;       // Current position in path
     int path[MAX_NODES]; // Flight path
     int pathLength;
 
-    ActiveFlight() : flightID(""), currentNodeID(-1), destinationNodeID(-1),
-                     priority(3), fuel(100), status(GROUNDED),
+    ActiveFlight() : flightID(NO_FLIGHT), currentNodeID(-1), destinationNodeID(-1),
+                     priority(3), fuel(100), burnRate(DEFAULT_BURN_RATE), status(GROUNDED),
                      pathIndex(0), pathLength(0) {}
 };
 
@@ -44,10 +54,98 @@ struct ActiveFlight
 class FlightManager
 {
 private:
-    ActiveFlight flights[MAX_ACTIVE_FLIGHTS];
+    ActiveFlight *flights; // Growable array of active flights
     int totalFlights;
+    int flightCapacity;
     Graph *graphPtr;        // Pointer to graph for coordinate access
     HashTable *registryPtr; // Pointer to aircraft registry
+    Journal *journalPtr;    // Write-ahead journal (optional)
+    AirportLandingQueues *landingQueuePtr; // Approaching flights per airport (optional)
+
+    FuelWatch fuelWatch; // active flights ordered by fuel
+    int currentTick;     // simulation ticks run so far
+
+    RunwayScheduler runways; // landing slots per airport
+    int approachingFlights;  // flights that should hold a landing slot
+
+    ConflictForecaster forecaster; // predicted node conflicts ahead
+
+    HoldingQueues holding; // flights waiting for an occupied node
+
+    // Contested nodes freed since they were last granted: a ring holding
+    // each node at most once, drained by resolveContention
+    int freedNodes[MAX_NODES];
+    bool freedPending[MAX_NODES];
+    int freedHead;
+    int freedCount;
+
+    // Flights at each node in arrival order, as an intrusive list by
+    // handle (links sized with indexOfHandle), so the occupant the graph
+    // shows is handed to the next arrival in O(1) when it leaves
+    FlightHandle occupantHead[MAX_NODES];
+    FlightHandle occupantTail[MAX_NODES];
+    FlightHandle *occupantNext;
+    FlightHandle *occupantPrev;
+
+    // Put a flight on its node in the graph and at the end of its list
+    void enterNode(ActiveFlight *flight);
+    void linkOccupant(FlightHandle flightID, int nodeID);
+
+    // Take a flight off its node in the graph; a node left free with
+    // flights holding for it is noted for the next grant
+    void leaveNode(ActiveFlight *flight);
+    void clearOccupants();
+    void noteFreed(int nodeID);
+    void clearFreed();
+
+    LandingIntake intake; // landing requests from other threads
+
+    // Move a flight into the next node of its path (node must be free)
+    void advanceFlight(ActiveFlight *flight);
+
+    // Fuel left after flying the rest of the path (may be negative)
+    int fuelMargin(ActiveFlight *flight);
+
+    // Grant each node freed since the last tick to one of the flights
+    // holding for it (priority, then fuel margin, then hold order);
+    // returns the grants
+    int resolveContention();
+
+    // Predict every active flight afresh (after a reset or a load)
+    void refreshForecast();
+
+    // First slot a newly sequenced flight may book (after the current one)
+    int nextLandingSlot();
+
+    // Book a landing slot for an approaching flight
+    void bookRunway(ActiveFlight *flight);
+
+    // Queue approaching flights that hold no slot and are not queued
+    // (booked directly when there is no landing queue)
+    void queueWaitingFlights();
+
+    // Flights booked or waiting in the landing queue
+    int sequencedFlights();
+
+    // Book runway slots for queued flights, most urgent airport and
+    // flight first (extractMin), until the landing queue is empty
+    void sequenceLandings();
+
+    // Handle -> index into flights[] (-1 when not active)
+    int *indexOfHandle;
+    int indexCapacity;
+
+    // Keep handle index in sync with flights[]
+    void setIndex(FlightHandle flightID, int index);
+    void reserveIndex(int handleCount);
+
+    // Grow flights[] to hold at least count flights
+    void reserveFlights(int count);
+
+    // Shared by addFlight and addPlannedFlight
+    bool validateNewFlight(const string &flightID, int startNodeID, int destNodeID);
+    void insertFlight(const string &flightID, int startNodeID, int destNodeID,
+                      int priority, const string &model, const int path[], int pathLength);
 
 public:
     // Constructor & Destructor
@@ -60,46 +158,104 @@ public:
     // Set registry reference
     void setRegistryReference(HashTable *reg);
 
+    // Set journal reference
+    void setJournalReference(Journal *j);
+
+    // Set landing queue reference
+    void setLandingQueueReference(AirportLandingQueues *queue);
+
     // Flight creation
-    bool addFlight(string flightID, int startNodeID, int destNodeID,
-                   int priority, string model);
+    bool addFlight(const string &flightID, int startNodeID, int destNodeID,
+                   int priority, const string &model);
+
+    // Flight creation with a route already planned (bulk import)
+    bool addPlannedFlight(const string &flightID, int startNodeID, int destNodeID,
+                          int priority, const string &model, const int path[], int pathLength);
 
     // Flight removal
-    bool removeFlight(string flightID);
+    bool removeFlight(const string &flightID);
+    bool removeFlight(FlightHandle flightID);
 
     // Find flight
-    ActiveFlight *getFlight(string flightID);
+    ActiveFlight *getFlight(const string &flightID);
+    ActiveFlight *getFlight(FlightHandle flightID);
 
-    // Flight movement (with collision detection)
-    bool moveFlightToNextNode(string flightID);
+    // Flight movement (with collision detection); a flight whose next
+    // node is occupied or already has flights waiting joins that node's
+    // holding queue, and the next tick after the node is freed grants it
+    bool moveFlightToNextNode(const string &flightID);
+
+    // Send a flight to another airport from where it is now; a flight
+    // already sequenced to land leaves the landing queue and its slot
+    bool divertFlight(const string &flightID, int newDestNodeID);
 
     // Emergency/Priority updates
-    bool declareEmergency(string flightID, int newPriority);
-    bool updateFuel(string flightID, int newFuel);
+    bool declareEmergency(const string &flightID, int newPriority);
+    bool declareEmergency(FlightHandle flightID, int newPriority);
+    bool updateFuel(const string &flightID, int newFuel);
+
+    // Landing requests from approach control: submit is safe from any
+    // thread and never blocks (false if the intake is full); the thread
+    // that owns the flight manager applies at most INTAKE_BATCH of them
+    // per call (the rest wait for the next call), each as a priority
+    // change by handle, and gets the number applied. API only:
+    // the menus change priorities directly, so nothing here submits yet
+    bool submitLandingRequest(FlightHandle flightID, int priority);
+    int sequenceLandingRequests();
+    size_t getPendingLandingRequests();
+
+    // Simulation: advance one tick, escalating low-fuel flights,
+    // releasing landings and granting contested nodes; returns the
+    // number of flights escalated
+    int tick();
+
+    // Book slots for the queued flights, then land every flight whose
+    // runway slot has come; returns the number of flights landed
+    int releaseLandings();
+    int getCurrentTick();
+    int countLowFuel(int threshold = LOW_FUEL_THRESHOLD);
 
     // Flight status
-    FlightStatus getFlightStatus(string flightID);
-    bool landFlight(string flightID);
+    FlightStatus getFlightStatus(const string &flightID);
+    bool landFlight(const string &flightID);
 
     // Display functions
     void displayAllActiveFlights();
-    void displayFlightDetails(string flightID);
-    void displayFlightPath(string flightID);
+    void displayFlightDetails(const string &flightID);
+    void displayFlightPath(const string &flightID);
+    void displayRunwaySchedule();
+    void displayConflictForecast();
+    void displayHoldingQueues();
+
+    // Conflict forecast over the next FORECAST_HORIZON ticks
+    long getPredictedConflicts();
+    int getFirstConflictTick();
+
+    // Flights waiting in holding queues
+    int getHoldingFlights();
 
     // Query functions
     int getTotalFlights();
-    bool flightExists(string flightID);
-    int getFlightNodeID(string flightID);
+    bool flightExists(const string &flightID);
+    int getFlightNodeID(const string &flightID);
 
     // Accessor for iterating active flights (read-only pointer)
     ActiveFlight *getFlightByIndex(int index);
 
     // Collision checking
-    bool checkCollision(int nodeID, string excludeFlightID = "");
+    bool checkCollision(int nodeID, const string &excludeFlightID = "");
+    bool checkCollision(int nodeID, FlightHandle excludeFlightID);
 
     // Save/Load functions
-    void saveToFile(string filename);
-    void loadFromFile(string filename);
+    void saveToFile(const string &filename);
+    void loadFromFile(const string &filename);
+
+    // Binary snapshot section (see Snapshot.h)
+    void saveBinary(BinaryWriter &out);
+    bool loadBinary(BinaryReader &in, const HandleRemap &remap);
+
+    // Checksum of the logical state (IDs hashed by name, not handle)
+    unsigned int stateChecksum();
 };
 
 #endif // FLIGHT_MANAGER_H
\ No newline at end of file
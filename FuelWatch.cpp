@@ -0,0 +1,232 @@
+#include "FuelWatch.h"
+
+using namespace std;
+
+// ========== BURN RATES ==========
+struct BurnRate
+{
+    const char *prefix;
+    int rate; // % of tank per 1000 km
+};
+
+// Larger aircraft carry proportionally more fuel per km flown
+const BurnRate BURN_RATES[] = {
+    {"A380", 45},
+    {"B747", 50},
+    {"B777", 50},
+    {"B787", 55},
+    {"A350", 55},
+    {"A330", 60},
+    {"B767", 60},
+    {"A321", 75},
+    {"A320", 80},
+    {"B737", 80},
+    {"E19", 110},
+    {"CRJ", 120},
+    {"ATR", 130}};
+
+const int BURN_RATE_COUNT = sizeof(BURN_RATES) / sizeof(BURN_RATES[0]);
+
+// ========== FUEL BURN RATE ==========
+int fuelBurnRate(const string &model)
+{
+    for (int i = 0; i < BURN_RATE_COUNT; i++)
+    {
+        if (model.compare(0, string(BURN_RATES[i].prefix).length(), BURN_RATES[i].prefix) == 0)
+        {
+            return BURN_RATES[i].rate;
+        }
+    }
+    return DEFAULT_BURN_RATE;
+}
+
+// ========== FUEL FOR DISTANCE ==========
+int fuelForDistance(int distanceKm, int burnRate)
+{
+    if (distanceKm <= 0)
+    {
+        return 1;
+    }
+
+    // Round up so every hop costs something
+    int fuel = (distanceKm * burnRate + 999) / 1000;
+    return fuel < 1 ? 1 : fuel;
+}
+
+// ========== CONSTRUCTOR ==========
+FuelWatch::FuelWatch()
+{
+    capacity = 0;
+    next = NULL;
+    prev = NULL;
+    level = NULL;
+
+    for (int i = 0; i < FUEL_LEVELS; i++)
+    {
+        head[i] = NO_FLIGHT;
+    }
+
+    reserve(64);
+}
+
+// ========== DESTRUCTOR ==========
+FuelWatch::~FuelWatch()
+{
+    delete[] next;
+    delete[] prev;
+    delete[] level;
+}
+
+// ========== GROW LINK ARRAYS ==========
+void FuelWatch::reserve(int handleCount)
+{
+    if (handleCount <= capacity)
+    {
+        return;
+    }
+
+    int newCapacity = capacity > 0 ? capacity : 64;
+    while (newCapacity < handleCount)
+    {
+        newCapacity *= 2;
+    }
+
+    FlightHandle *newNext = new FlightHandle[newCapacity];
+    FlightHandle *newPrev = new FlightHandle[newCapacity];
+    int *newLevel = new int[newCapacity];
+
+    for (int i = 0; i < newCapacity; i++)
+    {
+        bool old = i < capacity;
+        newNext[i] = old ? next[i] : NO_FLIGHT;
+        newPrev[i] = old ? prev[i] : NO_FLIGHT;
+        newLevel[i] = old ? level[i] : -1;
+    }
+
+    delete[] next;
+    delete[] prev;
+    delete[] level;
+    next = newNext;
+    prev = newPrev;
+    level = newLevel;
+    capacity = newCapacity;
+}
+
+// ========== UNLINK ==========
+void FuelWatch::unlink(FlightHandle flightID)
+{
+    int fuel = level[flightID];
+
+    if (prev[flightID] != NO_FLIGHT)
+        next[prev[flightID]] = next[flightID];
+    else
+        head[fuel] = next[flightID];
+
+    if (next[flightID] != NO_FLIGHT)
+        prev[next[flightID]] = prev[flightID];
+
+    next[flightID] = NO_FLIGHT;
+    prev[flightID] = NO_FLIGHT;
+    level[flightID] = -1;
+}
+
+// ========== INSERT ==========
+void FuelWatch::insert(FlightHandle flightID, int fuel)
+{
+    if (flightID == NO_FLIGHT)
+    {
+        return;
+    }
+
+    reserve((int)flightID + 1);
+    if (level[flightID] != -1)
+    {
+        unlink(flightID);
+    }
+
+    if (fuel < 0)
+        fuel = 0;
+    if (fuel >= FUEL_LEVELS)
+        fuel = FUEL_LEVELS - 1;
+
+    // Push onto the front of its level
+    next[flightID] = head[fuel];
+    prev[flightID] = NO_FLIGHT;
+    if (head[fuel] != NO_FLIGHT)
+    {
+        prev[head[fuel]] = flightID;
+    }
+    head[fuel] = flightID;
+    level[flightID] = fuel;
+}
+
+// ========== UPDATE ==========
+void FuelWatch::update(FlightHandle flightID, int fuel)
+{
+    if (flightID == NO_FLIGHT || (int)flightID >= capacity || level[flightID] == fuel)
+    {
+        return;
+    }
+    insert(flightID, fuel);
+}
+
+// ========== REMOVE ==========
+void FuelWatch::remove(FlightHandle flightID)
+{
+    if (flightID == NO_FLIGHT || (int)flightID >= capacity || level[flightID] == -1)
+    {
+        return;
+    }
+    unlink(flightID);
+}
+
+// ========== CLEAR ==========
+void FuelWatch::clear()
+{
+    for (int i = 0; i < FUEL_LEVELS; i++)
+    {
+        FlightHandle h = head[i];
+        while (h != NO_FLIGHT)
+        {
+            FlightHandle following = next[h];
+            next[h] = NO_FLIGHT;
+            prev[h] = NO_FLIGHT;
+            level[h] = -1;
+            h = following;
+        }
+        head[i] = NO_FLIGHT;
+    }
+}
+
+// ========== ITERATION ==========
+FlightHandle FuelWatch::first(int fuel)
+{
+    if (fuel < 0 || fuel >= FUEL_LEVELS)
+    {
+        return NO_FLIGHT;
+    }
+    return head[fuel];
+}
+
+FlightHandle FuelWatch::nextOf(FlightHandle flightID)
+{
+    if (flightID == NO_FLIGHT || (int)flightID >= capacity)
+    {
+        return NO_FLIGHT;
+    }
+    return next[flightID];
+}
+
+// ========== COUNT BELOW THRESHOLD ==========
+int FuelWatch::countBelow(int threshold)
+{
+    int count = 0;
+    for (int fuel = 0; fuel < threshold && fuel < FUEL_LEVELS; fuel++)
+    {
+        for (FlightHandle h = head[fuel]; h != NO_FLIGHT; h = next[h])
+        {
+            count++;
+        }
+    }
+    return count;
+}
@@ -0,0 +1,63 @@
+#ifndef FUEL_WATCH_H
+#define FUEL_WATCH_H
+
+#include <string>
+#include "IDInterner.h"
+
+using namespace std;
+
+// Fuel is tracked as a whole percentage 0-100
+const int FUEL_LEVELS = 101;
+
+// Flights below this fuel level are escalated each tick
+const int LOW_FUEL_THRESHOLD = 20;
+
+// Burn rate for models not in the table (% per 1000 km)
+const int DEFAULT_BURN_RATE = 80;
+
+// ========== FUEL BURN MODEL ==========
+// Fuel burn rate (% of tank per 1000 km) for an aircraft model
+int fuelBurnRate(const string &model);
+
+// Fuel (%) burned flying distanceKm at the given rate (at least 1)
+int fuelForDistance(int distanceKm, int burnRate);
+
+// ========== FUEL WATCH CLASS ==========
+// Index of active flights ordered by remaining fuel: one intrusive
+// doubly linked list per fuel level, linked by flight handle. Insert,
+// update and remove are O(1); visiting every flight below a threshold
+// costs O(threshold + k) for k matches.
+class FuelWatch
+{
+private:
+    FlightHandle head[FUEL_LEVELS];
+    FlightHandle *next;
+    FlightHandle *prev;
+    int *level; // -1 when the handle is not indexed
+    int capacity;
+
+    // Grow link arrays to cover handles below handleCount
+    void reserve(int handleCount);
+
+    void unlink(FlightHandle flightID);
+
+public:
+    // Constructor & Destructor
+    FuelWatch();
+    ~FuelWatch();
+
+    // Index maintenance
+    void insert(FlightHandle flightID, int fuel);
+    void update(FlightHandle flightID, int fuel);
+    void remove(FlightHandle flightID);
+    void clear();
+
+    // Iteration over one fuel level: first(fuel), then nextOf(h) until NO_FLIGHT
+    FlightHandle first(int fuel);
+    FlightHandle nextOf(FlightHandle flightID);
+
+    // Number of indexed flights with fuel below threshold
+    int countBelow(int threshold);
+};
+
+#endif // FUEL_WATCH_H
@@ -1,4 +1,6 @@
 #include "Graph.h"
+#include "Journal.h"
+#include "Logger.h"
 #include <cmath>
 #include <climits>
 
@@ -6,6 +8,7 @@
 Graph::Graph()
 {
     totalNodes = 0;
+    journalPtr = NULL;
 
     // Initialize all edge lists to NULL
     for (int i = 0; i < MAX_NODES; i++)
@@ -17,32 +20,43 @@ Graph::Graph()
 // ========== DESTRUCTOR ==========
 Graph::~Graph()
 {
-    // Delete all edge lists
-    for (int i = 0; i < MAX_NODES; i++)
-    {
-        EdgeNode *current = edges[i];
-        while (current != NULL)
-        {
-            EdgeNode *temp = current;
-            current = current->next;
-            delete temp;
-        }
-    }
+    // Edge nodes live in edgePool, which frees them all at once
+}
+
+// ========== SET JOURNAL REFERENCE ==========
+void Graph::setJournalReference(Journal *j)
+{
+    journalPtr = j;
 }
 
 // ========== ADD NODE (Airport or Waypoint) ==========
-void Graph::addNode(int id, string name, int x, int y, NodeType type)
+void Graph::addNode(int id, const string &name, int x, int y, NodeType type)
 {
+    JournalScope scope(journalPtr);
+
     if (totalNodes >= MAX_NODES)
     {
-        cout << "Cannot add more nodes. Maximum limit reached." << endl;
+        LOG_ERROR << "Cannot add more nodes. Maximum limit reached.";
+        return;
+    }
+
+    // IDs index per-node tables elsewhere (landing queues), so they are
+    // kept below MAX_NODES and unique
+    if (id < 0 || id >= MAX_NODES)
+    {
+        LOG_ERROR << "Error: Node ID must be 0-" << MAX_NODES - 1;
+        return;
+    }
+    if (getNode(id) != NULL)
+    {
+        LOG_ERROR << "Error: Node ID " << id << " is already in use";
         return;
     }
 
     // Validate coordinates for radar grid (0-29, 0-19)
     if (x < 0 || x >= 30 || y < 0 || y >= 20)
     {
-        cout << "Error: Coordinates out of radar grid bounds (0-29, 0-19)" << endl;
+        LOG_ERROR << "Error: Coordinates out of radar grid bounds (0-29, 0-19)";
         return;
     }
 
@@ -51,15 +65,23 @@ void Graph::addNode(int id, string name, int x, int y, NodeType type)
     nodes[totalNodes].x = x;
     nodes[totalNodes].y = y;
     nodes[totalNodes].type = type;
-    nodes[totalNodes].occupiedBy = "";
+    nodes[totalNodes].occupiedBy = NO_FLIGHT;
+    nodes[totalNodes].occupants = 0;
 
     totalNodes++;
-    cout << "Node added: " << name << " (ID: " << id << ") at (" << x << ", " << y << ")" << endl;
+    LOG_INFO << "Node added: " << name << " (ID: " << id << ") at (" << x << ", " << y << ")";
+
+    if (scope.recording())
+    {
+        journalPtr->logAddNode(id, name, x, y, type);
+    }
 }
 
 // ========== ADD EDGE (Connection between nodes) ==========
 void Graph::addEdge(int fromID, int toID, int weight)
 {
+    JournalScope scope(journalPtr);
+
     // Find the index of fromID in nodes array
     int fromIndex = -1;
     int toIndex = -1;
@@ -74,19 +96,72 @@ void Graph::addEdge(int fromID, int toID, int weight)
 
     if (fromIndex == -1 || toIndex == -1)
     {
-        cout << "Error: One or both nodes do not exist." << endl;
+        LOG_ERROR << "Error: One or both nodes do not exist.";
         return;
     }
 
     // Create new edge and add to linked list
     Edge newEdge(toID, weight);
 
-    EdgeNode *newEdgeNode = new EdgeNode(newEdge);
+    EdgeNode *newEdgeNode = edgePool.create(newEdge);
     newEdgeNode->next = edges[fromIndex];
     edges[fromIndex] = newEdgeNode;
 
-    cout << "Edge added: " << nodes[fromIndex].name << " -> "
-         << nodes[toIndex].name << " (Weight: " << weight << " km)" << endl;
+    LOG_INFO << "Edge added: " << nodes[fromIndex].name << " -> "
+             << nodes[toIndex].name << " (Weight: " << weight << " km)";
+
+    if (scope.recording())
+    {
+        journalPtr->logAddEdge(fromID, toID, weight);
+    }
+}
+
+// ========== LOAD DEFAULT AIRSPACE ==========
+void Graph::loadDefaultAirspace()
+{
+    // Add airports with grid coordinates (0-29, 0-19)
+    addNode(1, "JFK", 5, 2, AIRPORT);
+    addNode(2, "LHR", 25, 5, AIRPORT);
+    addNode(3, "CDG", 15, 8, AIRPORT);
+    addNode(4, "DXB", 28, 12, AIRPORT);
+
+    // Add waypoints with grid coordinates
+    addNode(5, "W1", 10, 3, WAYPOINT);
+    addNode(6, "W2", 20, 7, WAYPOINT);
+    addNode(7, "W3", 5, 10, WAYPOINT);
+    addNode(8, "W4", 23, 10, WAYPOINT);
+
+    // Add edges (flight corridors) with integer weights
+    addEdge(1, 5, 50);  // JFK to W1
+    addEdge(5, 2, 100); // W1 to LHR
+    addEdge(1, 6, 80);  // JFK to W2
+    addEdge(6, 3, 75);  // W2 to CDG
+    addEdge(2, 6, 90);  // LHR to W2
+    addEdge(6, 4, 120); // W2 to DXB
+    addEdge(3, 7, 110); // CDG to W3
+    addEdge(7, 4, 130); // W3 to DXB
+    addEdge(3, 8, 100); // CDG to W4
+    addEdge(8, 4, 85);  // W4 to DXB
+}
+
+// ========== GET EDGE WEIGHT ==========
+int Graph::getEdgeWeight(int fromID, int toID)
+{
+    for (int i = 0; i < totalNodes; i++)
+    {
+        if (nodes[i].id == fromID)
+        {
+            for (EdgeNode *e = edges[i]; e != NULL; e = e->next)
+            {
+                if (e->edge.toNode == toID)
+                {
+                    return e->edge.weight;
+                }
+            }
+            return -1;
+        }
+    }
+    return -1;
 }
 
 // ========== GET NODE BY ID ==========
@@ -103,7 +178,7 @@ Node *Graph::getNode(int nodeID)
 }
 
 // ========== GET NODE ID BY NAME ==========
-int Graph::getNodeID(string nodeName)
+int Graph::getNodeID(const string &nodeName)
 {
     for (int i = 0; i < totalNodes; i++)
     {
@@ -127,30 +202,54 @@ bool Graph::isOccupied(int nodeID)
     Node *node = getNode(nodeID);
     if (node != NULL)
     {
-        return node->occupiedBy != "";
+        return node->occupants > 0;
     }
     return false;
 }
 
+// ========== GET OCCUPANT ==========
+FlightHandle Graph::getOccupant(int nodeID)
+{
+    Node *node = getNode(nodeID);
+    return (node != NULL) ? node->occupiedBy : NO_FLIGHT;
+}
+
 // ========== OCCUPY NODE (Plane lands here) ==========
-void Graph::occupyNode(int nodeID, string flightID)
+void Graph::occupyNode(int nodeID, FlightHandle flight)
 {
     Node *node = getNode(nodeID);
     if (node != NULL)
     {
-        node->occupiedBy = flightID;
-        cout << "Node " << node->name << " occupied by flight " << flightID << endl;
+        if (node->occupants == 0)
+        {
+            node->occupiedBy = flight;
+        }
+        node->occupants++;
+        LOG_DEBUG << "Node " << node->name << " occupied by flight " << flightIDs().getName(flight);
     }
 }
 
 // ========== FREE NODE (Plane leaves) ==========
-void Graph::freeNode(int nodeID)
+void Graph::freeNode(int nodeID, FlightHandle stillThere)
 {
     Node *node = getNode(nodeID);
     if (node != NULL)
     {
-        node->occupiedBy = "";
-        cout << "Node " << node->name << " is now free." << endl;
+        if (node->occupants > 0)
+        {
+            node->occupants--;
+        }
+        if (node->occupants > 0)
+        {
+            if (stillThere != NO_FLIGHT)
+            {
+                node->occupiedBy = stillThere;
+            }
+            LOG_DEBUG << "Node " << node->name << " still holds " << node->occupants << " flight(s)";
+            return;
+        }
+        node->occupiedBy = NO_FLIGHT;
+        LOG_DEBUG << "Node " << node->name << " is now free.";
     }
 }
 
@@ -180,7 +279,7 @@ PathResult Graph::dijkstra(int startNodeID)
 
     if (startIndex == -1)
     {
-        cout << "Start node not found." << endl;
+        LOG_ERROR << "Start node not found.";
         return result;
     }
 
@@ -257,7 +356,7 @@ void Graph::getPath(int startID, int endID, int path[], int &pathLength)
 
     if (startIndex == -1 || endIndex == -1)
     {
-        cout << "Invalid start or end node." << endl;
+        LOG_ERROR << "Invalid start or end node.";
         return;
     }
 
@@ -266,8 +365,8 @@ void Graph::getPath(int startID, int endID, int path[], int &pathLength)
 
     if (result.distance[endIndex] == INT_MAX)
     {
-        cout << "No path exists from " << nodes[startIndex].name
-             << " to " << nodes[endIndex].name << endl;
+        LOG_ERROR << "No path exists from " << nodes[startIndex].name
+                  << " to " << nodes[endIndex].name;
         return;
     }
 
@@ -337,6 +436,8 @@ int Graph::findNearestAirport(int currentNodeID)
 // ========== DISPLAY ALL NODES ==========
 void Graph::displayAllNodes()
 {
+    logger().flush();
+
     cout << "\n+---------- ALL NODES IN AIRSPACE ----------+" << endl;
     cout << "Total Nodes: " << totalNodes << endl;
     cout << "+-------------------------------------------+" << endl;
@@ -347,7 +448,7 @@ void Graph::displayAllNodes()
              << " | Name: " << nodes[i].name
              << " | Type: " << (nodes[i].type == AIRPORT ? "AIRPORT" : "WAYPOINT")
              << " | Position: (" << nodes[i].x << ", " << nodes[i].y << ")"
-             << " | Occupied: " << (nodes[i].occupiedBy == "" ? "NO" : nodes[i].occupiedBy)
+             << " | Occupied: " << (nodes[i].occupiedBy == NO_FLIGHT ? "NO" : flightIDs().getName(nodes[i].occupiedBy))
              << endl;
     }
 
@@ -358,6 +459,8 @@ void Graph::displayAllNodes()
 // ========== DISPLAY PATH ==========
 void Graph::displayPath(int path[], int length)
 {
+    logger().flush();
+
     if (length == 0)
     {
         cout << "No path to display." << endl;
@@ -384,6 +487,8 @@ void Graph::displayPath(int path[], int length)
 // ========== DISPLAY COMPLETE GRAPH ==========
 void Graph::displayGraph()
 {
+    logger().flush();
+
     cout << "\n+========== AIRSPACE NETWORK ==========+" << endl;
     cout << "Total Nodes: " << totalNodes << "\n"
          << endl;
@@ -396,9 +501,9 @@ void Graph::displayGraph()
             cout << "[" << nodes[i].id << "] " << nodes[i].name
                  << " (" << typeStr << ") at (" << nodes[i].x << ", " << nodes[i].y << ")";
 
-            if (nodes[i].occupiedBy != "")
+            if (nodes[i].occupiedBy != NO_FLIGHT)
             {
-                cout << " - OCCUPIED by " << nodes[i].occupiedBy;
+                cout << " - OCCUPIED by " << flightIDs().getName(nodes[i].occupiedBy);
             }
             cout << endl;
 
@@ -427,4 +532,110 @@ void Graph::displayGraph()
     }
     cout << "+======================================+\n"
          << endl;
-}
\ No newline at end of file
+}
+
+// ========== SAVE BINARY SECTION ==========
+void Graph::saveBinary(BinaryWriter &out)
+{
+    out.writeI32(totalNodes);
+
+    for (int i = 0; i < totalNodes; i++)
+    {
+        out.writeI32(nodes[i].id);
+        out.writeString(nodes[i].name);
+        out.writeI32(nodes[i].x);
+        out.writeI32(nodes[i].y);
+        out.writeI32(nodes[i].type);
+        out.writeU32(nodes[i].occupiedBy);
+
+        // Edge list in list order
+        int edgeCount = 0;
+        for (EdgeNode *e = edges[i]; e != NULL; e = e->next)
+        {
+            edgeCount++;
+        }
+
+        out.writeI32(edgeCount);
+        for (EdgeNode *e = edges[i]; e != NULL; e = e->next)
+        {
+            out.writeI32(e->edge.toNode);
+            out.writeI32(e->edge.weight);
+        }
+    }
+}
+
+// ========== STATE CHECKSUM ==========
+unsigned int Graph::stateChecksum()
+{
+    BinaryWriter out;
+    out.writeI32(totalNodes);
+
+    for (int i = 0; i < totalNodes; i++)
+    {
+        out.writeI32(nodes[i].id);
+        out.writeString(nodes[i].name);
+        out.writeI32(nodes[i].x);
+        out.writeI32(nodes[i].y);
+        out.writeI32(nodes[i].type);
+        out.writeString(flightIDs().getName(nodes[i].occupiedBy));
+
+        for (EdgeNode *e = edges[i]; e != NULL; e = e->next)
+        {
+            out.writeI32(e->edge.toNode);
+            out.writeI32(e->edge.weight);
+        }
+        out.writeI32(-1);
+    }
+
+    return checksumBytes(out.getData(), out.getSize());
+}
+
+// ========== LOAD BINARY SECTION ==========
+bool Graph::loadBinary(BinaryReader &in, const HandleRemap &remap)
+{
+    int count = in.readI32();
+    if (!in.ok() || count < 0 || count > MAX_NODES)
+    {
+        return false;
+    }
+
+    // Drop current edges
+    edgePool.releaseAll();
+    for (int i = 0; i < MAX_NODES; i++)
+    {
+        edges[i] = NULL;
+    }
+
+    totalNodes = 0;
+    for (int i = 0; i < count; i++)
+    {
+        nodes[i].id = in.readI32();
+        nodes[i].name = in.readString();
+        nodes[i].x = in.readI32();
+        nodes[i].y = in.readI32();
+        nodes[i].type = static_cast<NodeType>(in.readI32());
+        nodes[i].occupiedBy = remap.map(in.readU32());
+        nodes[i].occupants = (nodes[i].occupiedBy != NO_FLIGHT) ? 1 : 0; // flights add the rest
+
+        int edgeCount = in.readI32();
+        if (!in.ok() || edgeCount < 0 || nodes[i].id < 0 || nodes[i].id >= MAX_NODES ||
+            getNode(nodes[i].id) != NULL)
+        {
+            return false;
+        }
+
+        // Append at the tail so list order matches the saved order
+        EdgeNode **tail = &edges[i];
+        for (int j = 0; j < edgeCount && in.ok(); j++)
+        {
+            int toNode = in.readI32();
+            int weight = in.readI32();
+            *tail = edgePool.create(Edge(toNode, weight));
+            tail = &((*tail)->next);
+        }
+
+        totalNodes++;
+    }
+
+    return in.ok();
+}
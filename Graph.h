@@ -4,10 +4,15 @@
 #include <string>
 #include <iostream>
 #include <climits>
+#include "IDInterner.h"
+#include "BinaryIO.h"
+#include "NodePool.h"
 
 using namespace std;
 
-const int MAX_NODES = 20;
+class Journal;
+
+const int MAX_NODES = 20; // node IDs are 0..MAX_NODES-1
 
 // Node type: Airport or Waypoint
 enum NodeType
@@ -23,12 +28,13 @@ struct Node
     string name;
     int x, y;
     NodeType type;
-    string occupiedBy;
+    FlightHandle occupiedBy; // NO_FLIGHT when free
+    int occupants;           // flights here (several may start at an airport)
 
-    Node() : id(-1), name(""), x(0), y(0), type(WAYPOINT), occupiedBy("") {}
+    Node() : id(-1), name(""), x(0), y(0), type(WAYPOINT), occupiedBy(NO_FLIGHT), occupants(0) {}
 
-    Node(int id, string name, int x, int y, NodeType type)
-        : id(id), name(name), x(x), y(y), type(type), occupiedBy("") {}
+    Node(int id, const string &name, int x, int y, NodeType type)
+        : id(id), name(name), x(x), y(y), type(type), occupiedBy(NO_FLIGHT), occupants(0) {}
 };
 
 // ========== SINGLE EDGE (Connection between nodes) ==========
@@ -63,30 +69,45 @@ class Graph
 private:
     Node nodes[MAX_NODES];      // All nodes
     EdgeNode *edges[MAX_NODES]; // Edges from each node
+    NodePool<EdgeNode> edgePool; // every edge node; released in bulk
     int totalNodes;
+    Journal *journalPtr; // Write-ahead journal (optional)
 
 public:
     // Constructor & Destructor
     Graph();
     ~Graph();
 
+    // Set journal reference
+    void setJournalReference(Journal *j);
+
     // Add nodes (airports and waypoints)
     // CHANGED: x, y are now int (0-29, 0-19) for direct radar grid use
-    void addNode(int id, string name, int x, int y, NodeType type);
+    void addNode(int id, const string &name, int x, int y, NodeType type);
 
     // Add edges (connections between nodes)
     // CHANGED: weight is now int
     void addEdge(int fromID, int toID, int weight);
 
+    // Build the standard 4-airport, 4-waypoint airspace
+    void loadDefaultAirspace();
+
     // Get node information
     Node *getNode(int nodeID);
-    int getNodeID(string nodeName);
+    int getNodeID(const string &nodeName);
     int getTotalNodes();
 
-    // Check if node is occupied
+    // Length of the direct edge fromID -> toID in km (-1 if none)
+    int getEdgeWeight(int fromID, int toID);
+
+    // Check if node is occupied; a node shared by several flights shows
+    // the first to arrive and stays occupied until the last one leaves
     bool isOccupied(int nodeID);
-    void occupyNode(int nodeID, string flightID);
-    void freeNode(int nodeID);
+    FlightHandle getOccupant(int nodeID);
+    void occupyNode(int nodeID, FlightHandle flight);
+    // One flight leaves; stillThere (another flight at the node) is
+    // shown as the occupant while any remain
+    void freeNode(int nodeID, FlightHandle stillThere = NO_FLIGHT);
 
     // Dijkstra's algorithm for shortest path
     PathResult dijkstra(int startNodeID);
@@ -101,6 +122,13 @@ public:
     void displayAllNodes();
     void displayPath(int path[], int length);
     void displayGraph();
+
+    // Binary snapshot section (see Snapshot.h)
+    void saveBinary(BinaryWriter &out);
+    bool loadBinary(BinaryReader &in, const HandleRemap &remap);
+
+    // Checksum of the logical state (IDs hashed by name, not handle)
+    unsigned int stateChecksum();
 };
 
 #endif // GRAPH_H
\ No newline at end of file
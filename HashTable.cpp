@@ -1,7 +1,11 @@
 #include "HashTable.h"
+#include "Journal.h"
+#include "ChangeFeed.h"
+#include "Logger.h"
 #include <iostream>
 #include <iomanip>
 #include <cstdlib>
+#include <cstring>
 
 using namespace std;
 
@@ -13,50 +17,313 @@ const string CYAN = "\033[36m";
 const string RESET = "\033[0m";
 const string BOLD = "\033[1m";
 
+// Status text, indexed by AircraftStatus
+const string STATUS_NAMES[] = {"UNKNOWN", "GROUNDED", "TAXIING", "FLYING", "HOLDING",
+                               "APPROACHING", "LANDING", "LANDED", "EMERGENCY", "CRASHED"};
+const int STATUS_COUNT = sizeof(STATUS_NAMES) / sizeof(STATUS_NAMES[0]);
+
+// ========== STATUS ENCODING ==========
+AircraftStatus parseAircraftStatus(const string &text)
+{
+    for (int i = 1; i < STATUS_COUNT; i++)
+    {
+        if (STATUS_NAMES[i] == text)
+        {
+            return static_cast<AircraftStatus>(i);
+        }
+    }
+    return AIRCRAFT_UNKNOWN;
+}
+
+const string &aircraftStatusName(AircraftStatus status)
+{
+    return STATUS_NAMES[status < STATUS_COUNT ? status : AIRCRAFT_UNKNOWN];
+}
+
+// ========== NAME DICTIONARIES ==========
+IDInterner &modelNames()
+{
+    static IDInterner dictionary;
+    return dictionary;
+}
+
+IDInterner &airportNames()
+{
+    static IDInterner dictionary;
+    return dictionary;
+}
+
+// Dictionary code for a name (0 if empty or the dictionary is full)
+static unsigned short encodeName(IDInterner &dictionary, const string &name)
+{
+    FlightHandle code = dictionary.intern(name);
+    if (code > (FlightHandle)MAX_NAME_CODE)
+    {
+        LOG_ERROR << RED << "[ERROR]" << RESET << " Name dictionary full - \"" << name << "\" not stored";
+        return 0;
+    }
+    return (unsigned short)code;
+}
+
 // ========== HASH FUNCTION ==========
-int HashTable::hashFunction(string flightID)
+unsigned int HashTable::hashHandle(FlightHandle flightID)
+{
+    // Murmur3 finalizer: dense handles would otherwise fill one run of
+    // slots and make every probe walk it
+    unsigned int h = flightID;
+    h ^= h >> 16;
+    h *= 0x85ebca6bU;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35U;
+    h ^= h >> 16;
+    return h;
+}
+
+// ========== FIND SLOT ==========
+int HashTable::findSlot(HashSlot *table, int mask, FlightHandle flightID) const
+{
+    int index = hashHandle(flightID) & mask;
+    for (int probe = 1;; probe++)
+    {
+        HashSlot &slot = table[index];
+
+        // A richer (or empty) slot means the key would have been placed
+        // before it
+        if (slot.probe < probe)
+        {
+            return -1;
+        }
+        if (slot.flightID == flightID)
+        {
+            return index;
+        }
+        index = (index + 1) & mask;
+    }
+}
+
+// ========== PLACE NODE (ROBIN HOOD) ==========
+void HashTable::placeNode(HashSlot *table, int mask, HashNode *node)
 {
-    int sum = 0;
+    HashSlot entry;
+    entry.flightID = node->aircraft.flightID;
+    entry.probe = 1;
+    entry.node = node;
 
-    // Sum all ASCII values of characters in flightID
-    for (int i = 0; i < flightID.length(); i++)
+    int index = hashHandle(entry.flightID) & mask;
+    while (table[index].probe > 0)
     {
-        sum += (int)flightID[i];
+        // Take the slot from a record closer to home and carry it on
+        if (table[index].probe < entry.probe)
+        {
+            HashSlot displaced = table[index];
+            table[index] = entry;
+            entry = displaced;
+        }
+        index = (index + 1) & mask;
+        entry.probe++;
     }
+    table[index] = entry;
+}
 
-    return sum % HASH_TABLE_SIZE;
+// ========== ERASE SLOT (BACKWARD SHIFT) ==========
+void HashTable::eraseSlot(HashSlot *table, int mask, int index)
+{
+    int next = (index + 1) & mask;
+    while (table[next].probe > 1)
+    {
+        table[index] = table[next];
+        table[index].probe--;
+        index = next;
+        next = (next + 1) & mask;
+    }
+    table[index] = HashSlot();
+}
+
+// ========== FIND NODE BY HANDLE ==========
+HashNode *HashTable::findNode(FlightHandle flightID)
+{
+    lookupCount++;
+    if (flightID == NO_FLIGHT)
+    {
+        return NULL;
+    }
+
+    int index = findSlot(slots, slotMask, flightID);
+    if (index != -1)
+    {
+        hitCount++;
+        return slots[index].node;
+    }
+
+    if (oldSlots != NULL)
+    {
+        index = findSlot(oldSlots, oldMask, flightID);
+        if (index != -1)
+        {
+            hitCount++;
+            return oldSlots[index].node;
+        }
+    }
+
+    return NULL;
+}
+
+// ========== FIND AIRCRAFT BY HANDLE ==========
+Aircraft *HashTable::findAircraft(FlightHandle flightID)
+{
+    HashNode *node = findNode(flightID);
+    return node != NULL ? &(node->aircraft) : NULL;
 }
 
 // ========== CONSTRUCTOR ==========
 HashTable::HashTable()
 {
     totalAircraft = 0;
+    journalPtr = NULL;
+    feedPtr = NULL;
+    slots = allocateSlots(HASH_TABLE_SIZE);
+    slotMask = HASH_TABLE_SIZE - 1;
+    oldSlots = NULL;
+    oldMask = 0;
+    rehashCursor = 0;
+    indexes = NULL;
+    lookupCount = 0;
+    hitCount = 0;
+
+    LOG_INFO << GREEN << "[SUCCESS] Hash Table initialized" << RESET;
+}
 
-    // Initialize all buckets to NULL
-    for (int i = 0; i < HASH_TABLE_SIZE; i++)
+// ========== DESTRUCTOR ==========
+HashTable::~HashTable()
+{
+    // The feed may already be gone at exit, and nobody is tailing
+    feedPtr = NULL;
+    clear();
+    free(slots);
+    delete[] indexes;
+
+    LOG_INFO << GREEN << "[SUCCESS] Hash Table destroyed" << RESET;
+}
+
+// ========== SET JOURNAL REFERENCE ==========
+void HashTable::setJournalReference(Journal *j)
+{
+    journalPtr = j;
+}
+
+// ========== SET CHANGE FEED ==========
+void HashTable::setChangeFeed(ChangeFeed *f)
+{
+    feedPtr = f;
+}
+
+// ========== CLEAR ALL RECORDS ==========
+void HashTable::clear()
+{
+    // Records have nothing to destruct, so the pool drops them all at
+    // once and the slots are simply zeroed back to empty
+    nodePool.releaseAll();
+    memset(slots, 0, (slotMask + 1) * sizeof(HashSlot));
+
+    if (oldSlots != NULL)
+    {
+        free(oldSlots);
+        oldSlots = NULL;
+    }
+
+    if (indexes != NULL)
+    {
+        for (int f = 0; f < REGISTRY_FIELDS; f++)
+        {
+            indexes[f].clear();
+        }
+    }
+
+    totalAircraft = 0;
+
+    if (feedPtr != NULL)
     {
-        buckets[i] = NULL;
+        feedPtr->publish(CHANGE_RESET, Aircraft());
     }
+}
 
-    cout << GREEN << "[SUCCESS] Hash Table initialized" << RESET << endl;
+// ========== ALLOCATE SLOTS ==========
+HashSlot *HashTable::allocateSlots(int size)
+{
+    // Large blocks come straight from the OS already zeroed, so pages
+    // are touched as slots fill instead of all at once
+    return static_cast<HashSlot *>(calloc(size, sizeof(HashSlot)));
 }
 
-// ========== DESTRUCTOR ==========
-HashTable::~HashTable()
+// ========== START INCREMENTAL REHASH ==========
+void HashTable::startRehash(int newSize)
 {
-    // Delete all nodes in all buckets
-    for (int i = 0; i < HASH_TABLE_SIZE; i++)
+    // Finish any earlier move first; only one old table is kept
+    if (oldSlots != NULL)
     {
-        HashNode *current = buckets[i];
-        while (current != NULL)
+        rehashStep(oldMask + 1);
+    }
+
+    oldSlots = slots;
+    oldMask = slotMask;
+    rehashCursor = 0;
+
+    slots = allocateSlots(newSize);
+    slotMask = newSize - 1;
+}
+
+// ========== INCREMENTAL REHASH STEP ==========
+void HashTable::rehashStep(int count)
+{
+    if (oldSlots == NULL)
+    {
+        return;
+    }
+
+    for (; count > 0 && rehashCursor <= oldMask; count--, rehashCursor++)
+    {
+        HashSlot &slot = oldSlots[rehashCursor];
+        if (slot.node != NULL)
         {
-            HashNode *temp = current;
-            current = current->next;
-            delete temp;
+            placeNode(slots, slotMask, slot.node);
+
+            // Keep the probe distance so later old-table probes pass it
+            slot.flightID = NO_FLIGHT;
+            slot.node = NULL;
         }
     }
 
-    cout << GREEN << "[SUCCESS] Hash Table destroyed" << RESET << endl;
+    if (rehashCursor > oldMask)
+    {
+        free(oldSlots);
+        oldSlots = NULL;
+    }
+}
+
+// ========== CHECK LOAD FACTOR ==========
+void HashTable::checkLoad()
+{
+    if (totalAircraft * 100 > (slotMask + 1) * HASH_MAX_LOAD_PERCENT)
+    {
+        startRehash((slotMask + 1) * 2);
+    }
+}
+
+// ========== RESERVE FOR BULK LOAD ==========
+void HashTable::reserve(int count)
+{
+    int size = slotMask + 1;
+    while ((long long)count * 100 > (long long)size * HASH_MAX_LOAD_PERCENT)
+    {
+        size *= 2;
+    }
+
+    if (size != slotMask + 1 && totalAircraft == 0 && oldSlots == NULL)
+    {
+        free(slots);
+        slots = allocateSlots(size);
+        slotMask = size - 1;
+    }
 }
 
 // ========== CLEAR SCREEN HELPER ==========
@@ -69,163 +336,298 @@ void HashTable::clearScreen()
 #endif
 }
 
+// ========== ENCODE / DECODE RECORD ==========
+void HashTable::encodeAircraft(Aircraft &a, const string &model, int fuel, const string &origin,
+                               const string &destination, const string &status)
+{
+    a.model = encodeName(modelNames(), model);
+    a.origin = encodeName(airportNames(), origin);
+    a.destination = encodeName(airportNames(), destination);
+    a.fuel = (unsigned char)(fuel < 0 ? 0 : (fuel > 100 ? 100 : fuel));
+    a.status = parseAircraftStatus(status);
+
+    if (a.status == AIRCRAFT_UNKNOWN && status != aircraftStatusName(AIRCRAFT_UNKNOWN))
+    {
+        LOG_WARNING << YELLOW << "[WARNING]" << RESET << " Unknown status \"" << status
+                    << "\" stored as UNKNOWN";
+    }
+}
+
+void HashTable::writeDecoded(BinaryWriter &out, const Aircraft &a)
+{
+    out.writeString(modelNames().getName(a.model));
+    out.writeI32(a.fuel);
+    out.writeString(airportNames().getName(a.origin));
+    out.writeString(airportNames().getName(a.destination));
+    out.writeString(aircraftStatusName(static_cast<AircraftStatus>(a.status)));
+}
+
 // ========== INSERT/UPDATE AIRCRAFT ==========
-void HashTable::insertAircraft(string flightID, string model, int fuel,
-                               string origin, string destination, string status)
+void HashTable::insertAircraft(const string &flightID, const string &model, int fuel,
+                               const string &origin, const string &destination, const string &status)
 {
+    JournalScope scope(journalPtr);
+    if (scope.recording())
+    {
+        journalPtr->logRegistryInsert(flightID, model, fuel, origin, destination, status);
+    }
+
+    Aircraft record;
+    record.flightID = flightIDs().intern(flightID);
+    encodeAircraft(record, model, fuel, origin, destination, status);
 
-    // Calculate hash
-    int bucket = hashFunction(flightID);
+    if (!storeRecord(record))
+    {
+        LOG_INFO << YELLOW << "[UPDATE]" << RESET << " Flight " << CYAN << flightID
+                 << RESET << " updated successfully";
+        return;
+    }
+
+    LOG_INFO << GREEN << "[INSERT]" << RESET << " Flight " << CYAN << flightID
+             << RESET << " added to registry";
+}
+
+void HashTable::insertAircraft(const Aircraft &record)
+{
+    storeRecord(record);
+}
 
+// ========== STORE RECORD ==========
+bool HashTable::storeRecord(const Aircraft &record)
+{
     // Check if aircraft already exists
-    HashNode *current = buckets[bucket];
-    while (current != NULL)
+    Aircraft *existing = findAircraft(record.flightID);
+    if (existing != NULL)
     {
-        if (current->aircraft.flightID == flightID)
+        // Aircraft exists, update it
+        unindexRecord(*existing);
+        *existing = record;
+        indexRecord(*existing);
+        if (feedPtr != NULL)
         {
-            // Aircraft exists, update it
-            current->aircraft.model = model;
-            current->aircraft.fuel = fuel;
-            current->aircraft.origin = origin;
-            current->aircraft.destination = destination;
-            current->aircraft.status = status;
-
-            cout << YELLOW << "[UPDATE]" << RESET << " Flight " << CYAN << flightID
-                 << RESET << " updated successfully" << endl;
-            return;
+            feedPtr->publish(CHANGE_UPDATE, *existing);
         }
-        current = current->next;
+        return false;
     }
 
-    // Aircraft doesn't exist, create new node
-    Aircraft newAircraft(flightID, model, fuel, origin, destination, status);
-    HashNode *newNode = new HashNode(newAircraft);
-
-    // Insert at the beginning of the chain
-    newNode->next = buckets[bucket];
-    buckets[bucket] = newNode;
+    // Aircraft doesn't exist, create new node (new records always go
+    // into the current table)
+    placeNode(slots, slotMask, nodePool.create(record));
+    indexRecord(record);
     totalAircraft++;
+    if (feedPtr != NULL)
+    {
+        feedPtr->publish(CHANGE_INSERT, record);
+    }
 
-    cout << GREEN << "[INSERT]" << RESET << " Flight " << CYAN << flightID
-         << RESET << " added to registry" << endl;
+    rehashStep(HASH_REHASH_STEP);
+    checkLoad();
+    return true;
 }
 
 // ========== SEARCH AIRCRAFT ==========
-Aircraft *HashTable::searchAircraft(string flightID)
+Aircraft *HashTable::searchAircraft(const string &flightID)
 {
-    // Calculate hash
-    int bucket = hashFunction(flightID);
+    // Unknown IDs were never interned, so they miss without a table walk
+    Aircraft *aircraft = findAircraft(flightIDs().lookup(flightID));
 
-    // Traverse the chain at this bucket
-    HashNode *current = buckets[bucket];
-    while (current != NULL)
+    if (aircraft != NULL)
     {
-        if (current->aircraft.flightID == flightID)
-        {
-            cout << GREEN << "[FOUND]" << RESET << " Flight " << CYAN << flightID
-                 << RESET << " located in database" << endl;
-            return &(current->aircraft);
-        }
-        current = current->next;
+        LOG_INFO << GREEN << "[FOUND]" << RESET << " Flight " << CYAN << flightID
+                 << RESET << " located in database";
+        return aircraft;
     }
 
     // Aircraft not found
-    cout << RED << "[NOT FOUND]" << RESET << " Flight " << CYAN << flightID
-         << RESET << " does not exist" << endl;
+    LOG_INFO << RED << "[NOT FOUND]" << RESET << " Flight " << CYAN << flightID
+             << RESET << " does not exist";
     return NULL;
 }
 
 // ========== UPDATE STATUS ==========
-void HashTable::updateStatus(string flightID, string newStatus)
+void HashTable::updateStatus(const string &flightID, const string &newStatus)
 {
+    JournalScope scope(journalPtr);
+    AircraftStatus status = parseAircraftStatus(newStatus);
+    if (status == AIRCRAFT_UNKNOWN)
+    {
+        LOG_ERROR << RED << "[ERROR]" << RESET << " Unknown status \"" << newStatus << "\"";
+        return;
+    }
+
     Aircraft *aircraft = searchAircraft(flightID);
 
     if (aircraft != NULL)
     {
-        aircraft->status = newStatus;
-        cout << YELLOW << "[UPDATE]" << RESET << " Status changed to "
-             << CYAN << newStatus << RESET << endl;
+        setStatus(aircraft, status);
+        if (scope.recording())
+        {
+            journalPtr->logRegistryStatus(flightID, newStatus);
+        }
+        LOG_INFO << YELLOW << "[UPDATE]" << RESET << " Status changed to "
+                 << CYAN << newStatus << RESET;
     }
     else
     {
-        cout << RED << "[ERROR]" << RESET << " Cannot update status - flight not found" << endl;
+        LOG_ERROR << RED << "[ERROR]" << RESET << " Cannot update status - flight not found";
+    }
+}
+
+bool HashTable::updateStatus(FlightHandle flightID, AircraftStatus newStatus)
+{
+    Aircraft *aircraft = findAircraft(flightID);
+    if (aircraft == NULL || newStatus == AIRCRAFT_UNKNOWN)
+    {
+        return false;
+    }
+
+    setStatus(aircraft, newStatus);
+    return true;
+}
+
+void HashTable::setStatus(Aircraft *aircraft, AircraftStatus status)
+{
+    if (indexes != NULL)
+    {
+        indexes[FIELD_STATUS].remove(aircraft->flightID, aircraft->status);
+        indexes[FIELD_STATUS].add(aircraft->flightID, status);
+    }
+    aircraft->status = status;
+    if (feedPtr != NULL)
+    {
+        feedPtr->publish(CHANGE_STATUS, *aircraft);
     }
 }
 
 // ========== UPDATE FUEL ==========
-void HashTable::updateFuel(string flightID, int newFuel)
+void HashTable::updateFuel(const string &flightID, int newFuel)
 {
+    JournalScope scope(journalPtr);
     Aircraft *aircraft = searchAircraft(flightID);
 
     if (aircraft != NULL)
     {
         if (newFuel < 0 || newFuel > 100)
         {
-            cout << RED << "[ERROR]" << RESET << " Fuel must be between 0-100%" << endl;
+            LOG_ERROR << RED << "[ERROR]" << RESET << " Fuel must be between 0-100%";
             return;
         }
 
-        aircraft->fuel = newFuel;
-        cout << YELLOW << "[UPDATE]" << RESET << " Fuel updated to "
-             << CYAN << newFuel << "%" << RESET << endl;
+        setFuel(aircraft, newFuel);
+        if (scope.recording())
+        {
+            journalPtr->logFlightValue(OP_REGISTRY_FUEL, aircraft->flightID, newFuel);
+        }
+        LOG_INFO << YELLOW << "[UPDATE]" << RESET << " Fuel updated to "
+                 << CYAN << newFuel << "%" << RESET;
 
         // Alert if fuel is low
         if (newFuel < 10)
         {
-            cout << RED << "[ALERT]" << RESET << " Low fuel warning! "
-                 << "Fuel at " << newFuel << "%" << endl;
+            LOG_WARNING << RED << "[ALERT]" << RESET << " Low fuel warning! "
+                        << "Fuel at " << newFuel << "%";
         }
     }
     else
     {
-        cout << RED << "[ERROR]" << RESET << " Cannot update fuel - flight not found" << endl;
+        LOG_ERROR << RED << "[ERROR]" << RESET << " Cannot update fuel - flight not found";
     }
 }
 
-// ========== DELETE AIRCRAFT ==========
-bool HashTable::deleteAircraft(string flightID)
+bool HashTable::updateFuel(FlightHandle flightID, int newFuel)
 {
-    int bucket = hashFunction(flightID);
+    Aircraft *aircraft = findAircraft(flightID);
+    if (aircraft == NULL || newFuel < 0 || newFuel > 100)
+    {
+        return false;
+    }
+
+    setFuel(aircraft, newFuel);
+    return true;
+}
 
-    // Special case: if head of chain matches
-    if (buckets[bucket] != NULL && buckets[bucket]->aircraft.flightID == flightID)
+void HashTable::setFuel(Aircraft *aircraft, int newFuel)
+{
+    aircraft->fuel = newFuel;
+    if (feedPtr != NULL)
     {
-        HashNode *temp = buckets[bucket];
-        buckets[bucket] = buckets[bucket]->next;
-        delete temp;
-        totalAircraft--;
+        feedPtr->publish(CHANGE_FUEL, *aircraft);
+    }
+}
 
-        cout << GREEN << "[DELETE]" << RESET << " Flight " << CYAN << flightID
-             << RESET << " removed from registry" << endl;
-        return true;
+// ========== DELETE AIRCRAFT ==========
+bool HashTable::deleteAircraft(const string &flightID)
+{
+    JournalScope scope(journalPtr);
+    if (!removeRecord(flightIDs().lookup(flightID)))
+    {
+        LOG_ERROR << RED << "[ERROR]" << RESET << " Flight " << CYAN << flightID
+                  << RESET << " not found in registry";
+        return false;
     }
 
-    // Search in the chain
-    HashNode *current = buckets[bucket];
-    while (current != NULL && current->next != NULL)
+    LOG_INFO << GREEN << "[DELETE]" << RESET << " Flight " << CYAN << flightID
+             << RESET << " removed from registry";
+    if (scope.recording())
     {
-        if (current->next->aircraft.flightID == flightID)
-        {
-            HashNode *temp = current->next;
-            current->next = current->next->next;
-            delete temp;
-            totalAircraft--;
+        journalPtr->logRegistryDelete(flightID);
+    }
+    return true;
+}
 
-            cout << GREEN << "[DELETE]" << RESET << " Flight " << CYAN << flightID
-                 << RESET << " removed from registry" << endl;
-            return true;
+bool HashTable::deleteAircraft(FlightHandle flightID)
+{
+    return removeRecord(flightID);
+}
+
+// ========== REMOVE RECORD ==========
+bool HashTable::removeRecord(FlightHandle handle)
+{
+    HashNode *node = NULL;
+    lookupCount++;
+
+    int index = handle != NO_FLIGHT ? findSlot(slots, slotMask, handle) : -1;
+    if (index != -1)
+    {
+        node = slots[index].node;
+        eraseSlot(slots, slotMask, index);
+    }
+    else if (handle != NO_FLIGHT && oldSlots != NULL)
+    {
+        // Leave a moved-style marker; the old table is dropped after the rehash
+        index = findSlot(oldSlots, oldMask, handle);
+        if (index != -1)
+        {
+            node = oldSlots[index].node;
+            oldSlots[index].flightID = NO_FLIGHT;
+            oldSlots[index].node = NULL;
         }
-        current = current->next;
     }
 
-    cout << RED << "[ERROR]" << RESET << " Flight " << CYAN << flightID
-         << RESET << " not found in registry" << endl;
-    return false;
+    if (node == NULL)
+    {
+        return false;
+    }
+
+    hitCount++;
+    unindexRecord(node->aircraft);
+    if (feedPtr != NULL)
+    {
+        Aircraft removed;
+        removed.flightID = handle;
+        feedPtr->publish(CHANGE_DELETE, removed);
+    }
+    nodePool.destroy(node);
+    totalAircraft--;
+    rehashStep(HASH_REHASH_STEP);
+    return true;
 }
 
 // ========== DISPLAY ALL AIRCRAFT ==========
 void HashTable::displayAllAircraft()
 {
+    logger().flush();
+
     clearScreen();
 
     cout << BOLD << CYAN;
@@ -246,20 +648,22 @@ void HashTable::displayAllAircraft()
     cout << "  +----------------------------------------------------------+\n"
          << RESET << endl;
 
+    // Records still in the old table (mid-rehash) are listed first
+    HashSlot *tables[2] = {oldSlots, slots};
+    int sizes[2] = {oldSlots != NULL ? oldMask + 1 : 0, slotMask + 1};
+
     int count = 1;
-    for (int i = 0; i < HASH_TABLE_SIZE; i++)
+    for (int t = 0; t < 2; t++)
     {
-        HashNode *current = buckets[i];
-        while (current != NULL)
+        for (int i = 0; i < sizes[t]; i++)
         {
-            cout << BOLD << "  " << count << ". " << RESET;
-            cout << CYAN << setw(12) << current->aircraft.flightID << RESET << " | ";
-            cout << GREEN << setw(15) << current->aircraft.model << RESET << " | ";
-            cout << YELLOW << "Fuel: " << setw(3) << current->aircraft.fuel << "% " << RESET << "| ";
-            cout << current->aircraft.origin << " -> " << current->aircraft.destination;
-            cout << endl;
-
-            current = current->next;
+            HashNode *current = tables[t][i].node;
+            if (current == NULL)
+            {
+                continue;
+            }
+
+            displayRow(count, current->aircraft);
             count++;
         }
     }
@@ -267,9 +671,23 @@ void HashTable::displayAllAircraft()
     cout << endl;
 }
 
+// ========== DISPLAY REGISTRY ROW ==========
+void HashTable::displayRow(int number, const Aircraft &a)
+{
+    cout << BOLD << "  " << number << ". " << RESET;
+    cout << CYAN << setw(12) << flightIDs().getName(a.flightID) << RESET << " | ";
+    cout << GREEN << setw(15) << modelNames().getName(a.model) << RESET << " | ";
+    cout << YELLOW << "Fuel: " << setw(3) << (int)a.fuel << "% " << RESET << "| ";
+    cout << setw(11) << aircraftStatusName(static_cast<AircraftStatus>(a.status)) << " | ";
+    cout << airportNames().getName(a.origin) << " -> " << airportNames().getName(a.destination);
+    cout << endl;
+}
+
 // ========== DISPLAY SPECIFIC AIRCRAFT ==========
-void HashTable::displayAircraft(string flightID)
+void HashTable::displayAircraft(const string &flightID)
 {
+    logger().flush();
+
     Aircraft *aircraft = searchAircraft(flightID);
 
     if (aircraft == NULL)
@@ -280,12 +698,12 @@ void HashTable::displayAircraft(string flightID)
     cout << BOLD << CYAN << "\n+------------- AIRCRAFT DETAILS ----------+\n"
          << RESET;
 
-    cout << "  " << BOLD << "Flight ID: " << RESET << CYAN << aircraft->flightID << RESET << endl;
-    cout << "  " << BOLD << "Model: " << RESET << GREEN << aircraft->model << RESET << endl;
-    cout << "  " << BOLD << "Fuel: " << RESET << YELLOW << aircraft->fuel << "%" << RESET << endl;
-    cout << "  " << BOLD << "Origin: " << RESET << aircraft->origin << endl;
-    cout << "  " << BOLD << "Destination: " << RESET << aircraft->destination << endl;
-    cout << "  " << BOLD << "Status: " << RESET << aircraft->status << endl;
+    cout << "  " << BOLD << "Flight ID: " << RESET << CYAN << flightIDs().getName(aircraft->flightID) << RESET << endl;
+    cout << "  " << BOLD << "Model: " << RESET << GREEN << modelNames().getName(aircraft->model) << RESET << endl;
+    cout << "  " << BOLD << "Fuel: " << RESET << YELLOW << (int)aircraft->fuel << "%" << RESET << endl;
+    cout << "  " << BOLD << "Origin: " << RESET << airportNames().getName(aircraft->origin) << endl;
+    cout << "  " << BOLD << "Destination: " << RESET << airportNames().getName(aircraft->destination) << endl;
+    cout << "  " << BOLD << "Status: " << RESET << aircraftStatusName(static_cast<AircraftStatus>(aircraft->status)) << endl;
 
     cout << BOLD << CYAN << "+----------------------------------------+\n"
          << RESET << endl;
@@ -298,19 +716,416 @@ int HashTable::getTotalAircraft()
 }
 
 // ========== CHECK IF AIRCRAFT EXISTS ==========
-bool HashTable::exists(string flightID)
+bool HashTable::exists(const string &flightID)
 {
-    int bucket = hashFunction(flightID);
+    return findAircraft(flightIDs().lookup(flightID)) != NULL;
+}
+
+// ========== INDEX KEYS ==========
+int HashTable::fieldKey(const Aircraft &a, RegistryField field)
+{
+    switch (field)
+    {
+    case FIELD_STATUS:
+        return a.status;
+    case FIELD_ORIGIN:
+        return a.origin;
+    case FIELD_DESTINATION:
+        return a.destination;
+    case FIELD_MODEL:
+        return a.model;
+    }
+    return -1;
+}
 
-    HashNode *current = buckets[bucket];
-    while (current != NULL)
+int HashTable::valueKey(RegistryField field, const string &value)
+{
+    if (field == FIELD_STATUS)
     {
-        if (current->aircraft.flightID == flightID)
+        AircraftStatus status = parseAircraftStatus(value);
+        if (status == AIRCRAFT_UNKNOWN && value != aircraftStatusName(AIRCRAFT_UNKNOWN))
         {
+            return -1;
+        }
+        return status;
+    }
+
+    IDInterner &dictionary = field == FIELD_MODEL ? modelNames() : airportNames();
+    FlightHandle code = dictionary.lookup(value);
+    if (code == NO_FLIGHT || code > (FlightHandle)MAX_NAME_CODE)
+    {
+        return -1;
+    }
+    return (int)code;
+}
+
+// ========== INDEX / UNINDEX RECORD ==========
+void HashTable::indexRecord(const Aircraft &a)
+{
+    if (indexes == NULL)
+    {
+        return;
+    }
+
+    for (int f = 0; f < REGISTRY_FIELDS; f++)
+    {
+        indexes[f].add(a.flightID, fieldKey(a, static_cast<RegistryField>(f)));
+    }
+}
+
+void HashTable::unindexRecord(const Aircraft &a)
+{
+    if (indexes == NULL)
+    {
+        return;
+    }
+
+    for (int f = 0; f < REGISTRY_FIELDS; f++)
+    {
+        indexes[f].remove(a.flightID, fieldKey(a, static_cast<RegistryField>(f)));
+    }
+}
+
+// ========== ENABLE / DISABLE INDEXES ==========
+void HashTable::enableIndexes()
+{
+    if (indexes != NULL)
+    {
+        return;
+    }
+
+    indexes = new AttributeIndex[REGISTRY_FIELDS];
+
+    HashSlot *tables[2] = {oldSlots, slots};
+    int sizes[2] = {oldSlots != NULL ? oldMask + 1 : 0, slotMask + 1};
+    for (int t = 0; t < 2; t++)
+    {
+        for (int i = 0; i < sizes[t]; i++)
+        {
+            if (tables[t][i].node != NULL)
+            {
+                indexRecord(tables[t][i].node->aircraft);
+            }
+        }
+    }
+
+    LOG_INFO << GREEN << "[SUCCESS]" << RESET << " Registry indexes built over "
+             << totalAircraft << " aircraft";
+}
+
+void HashTable::disableIndexes()
+{
+    delete[] indexes;
+    indexes = NULL;
+}
+
+bool HashTable::hasIndexes()
+{
+    return indexes != NULL;
+}
+
+// ========== FIND MATCHING AIRCRAFT ==========
+int HashTable::findMatching(RegistryField field, const string &value,
+                            FlightHandle out[], int maxCount)
+{
+    return findMatching(field, value, field, "", out, maxCount);
+}
+
+int HashTable::findMatching(RegistryField field, const string &value,
+                            RegistryField alsoField, const string &alsoValue,
+                            FlightHandle out[], int maxCount)
+{
+    bool any = alsoValue.empty();
+    int key = valueKey(field, value);
+    int alsoKey = any ? 0 : valueKey(alsoField, alsoValue);
+    if (key == -1 || alsoKey == -1)
+    {
+        return 0;
+    }
+
+    int found = 0;
+
+    if (indexes != NULL)
+    {
+        // Walk the shorter list and check the other field on each record
+        if (!any && indexes[alsoField].count(alsoKey) < indexes[field].count(key))
+        {
+            RegistryField f = field;
+            field = alsoField;
+            alsoField = f;
+            int k = key;
+            key = alsoKey;
+            alsoKey = k;
+        }
+
+        Aircraft a;
+        for (FlightHandle h = indexes[field].first(key); h != NO_FLIGHT; h = indexes[field].nextOf(h))
+        {
+            if (!any && (!copyAircraft(h, a) || fieldKey(a, alsoField) != alsoKey))
+            {
+                continue;
+            }
+            if (found < maxCount)
+            {
+                out[found] = h;
+            }
+            found++;
+        }
+        return found;
+    }
+
+    // No indexes: check every record
+    HashSlot *tables[2] = {oldSlots, slots};
+    int sizes[2] = {oldSlots != NULL ? oldMask + 1 : 0, slotMask + 1};
+    for (int t = 0; t < 2; t++)
+    {
+        for (int i = 0; i < sizes[t]; i++)
+        {
+            HashNode *node = tables[t][i].node;
+            if (node == NULL || fieldKey(node->aircraft, field) != key ||
+                (!any && fieldKey(node->aircraft, alsoField) != alsoKey))
+            {
+                continue;
+            }
+            if (found < maxCount)
+            {
+                out[found] = node->aircraft.flightID;
+            }
+            found++;
+        }
+    }
+    return found;
+}
+
+// ========== DISPLAY MATCHING AIRCRAFT ==========
+void HashTable::displayMatching(RegistryField field, const string &value,
+                                RegistryField alsoField, const string &alsoValue)
+{
+    const string FIELD_NAMES[REGISTRY_FIELDS] = {"Status", "Origin", "Destination", "Model"};
+
+    int total = findMatching(field, value, alsoField, alsoValue, NULL, 0);
+    FlightHandle *matches = new FlightHandle[total > 0 ? total : 1];
+    findMatching(field, value, alsoField, alsoValue, matches, total);
+
+    logger().flush();
+
+    cout << BOLD << CYAN << "\n+------------- REGISTRY QUERY ------------+\n"
+         << RESET;
+    cout << "  " << BOLD << FIELD_NAMES[field] << ": " << RESET << value;
+    if (!alsoValue.empty())
+    {
+        cout << "  " << BOLD << FIELD_NAMES[alsoField] << ": " << RESET << alsoValue;
+    }
+    cout << "  (" << (indexes != NULL ? "indexed" : "full scan") << ")" << endl
+         << endl;
+
+    if (total == 0)
+    {
+        cout << YELLOW << "  No matching aircraft\n"
+             << RESET << endl;
+        delete[] matches;
+        return;
+    }
+
+    Aircraft a;
+    for (int i = 0; i < total; i++)
+    {
+        if (copyAircraft(matches[i], a))
+        {
+            displayRow(i + 1, a);
+        }
+    }
+    cout << endl
+         << "  Matches: " << CYAN << total << RESET << endl
+         << endl;
+
+    delete[] matches;
+}
+
+// ========== REGISTRY STATISTICS ==========
+RegistryStats HashTable::getStats()
+{
+    RegistryStats stats;
+    stats.records = totalAircraft;
+    stats.slots = slotMask + 1 + (oldSlots != NULL ? oldMask + 1 : 0);
+    stats.loadFactor = (double)totalAircraft / (slotMask + 1);
+    stats.rehashing = oldSlots != NULL;
+    stats.maxProbe = 0;
+    stats.lookups = lookupCount;
+    stats.hits = hitCount;
+    stats.misses = lookupCount - hitCount;
+    for (int i = 0; i < PROBE_HISTOGRAM_SIZE; i++)
+    {
+        stats.probeHistogram[i] = 0;
+    }
+
+    HashSlot *tables[2] = {oldSlots, slots};
+    int sizes[2] = {oldSlots != NULL ? oldMask + 1 : 0, slotMask + 1};
+    long long probeTotal = 0;
+
+    for (int t = 0; t < 2; t++)
+    {
+        for (int i = 0; i < sizes[t]; i++)
+        {
+            if (tables[t][i].node == NULL)
+            {
+                continue;
+            }
+
+            int probe = tables[t][i].probe;
+            probeTotal += probe;
+            if (probe > stats.maxProbe)
+            {
+                stats.maxProbe = probe;
+            }
+            stats.probeHistogram[probe < PROBE_HISTOGRAM_SIZE ? probe - 1 : PROBE_HISTOGRAM_SIZE - 1]++;
+        }
+    }
+
+    stats.averageProbe = totalAircraft > 0 ? (double)probeTotal / totalAircraft : 0.0;
+    return stats;
+}
+
+// ========== DISPLAY REGISTRY STATISTICS ==========
+void HashTable::displayStats()
+{
+    logger().flush();
+
+    RegistryStats stats = getStats();
+
+    cout << BOLD << CYAN << "\n  Registry Statistics\n"
+         << RESET;
+    cout << "  Records:        " << stats.records << " in " << stats.slots << " slots"
+         << (stats.rehashing ? " (growing)" : "") << endl;
+    ios::fmtflags flags = cout.flags();
+    streamsize precision = cout.precision();
+    cout << "  Load Factor:    " << fixed << setprecision(2) << stats.loadFactor << endl;
+    cout << "  Probe Length:   avg " << stats.averageProbe << ", max " << stats.maxProbe << endl;
+    cout.flags(flags);
+    cout.precision(precision);
+    cout << "  Lookups:        " << stats.lookups << " (" << GREEN << stats.hits << " hits" << RESET
+         << ", " << YELLOW << stats.misses << " misses" << RESET << ")" << endl;
+
+    cout << "  Probe Histogram:" << endl;
+    for (int i = 0; i < PROBE_HISTOGRAM_SIZE; i++)
+    {
+        int barLength = stats.records > 0 ? (stats.probeHistogram[i] * 40 + stats.records - 1) / stats.records : 0;
+        cout << "    " << (i + 1) << (i == PROBE_HISTOGRAM_SIZE - 1 ? "+" : " ") << " | "
+             << CYAN << string(barLength, '#') << RESET << " " << stats.probeHistogram[i] << endl;
+    }
+}
+
+// ========== COPY RECORD (READ-ONLY) ==========
+bool HashTable::copyAircraft(FlightHandle flightID, Aircraft &out) const
+{
+    if (flightID == NO_FLIGHT)
+    {
+        return false;
+    }
+
+    int index = findSlot(slots, slotMask, flightID);
+    if (index != -1)
+    {
+        out = slots[index].node->aircraft;
+        return true;
+    }
+
+    if (oldSlots != NULL)
+    {
+        index = findSlot(oldSlots, oldMask, flightID);
+        if (index != -1)
+        {
+            out = oldSlots[index].node->aircraft;
             return true;
         }
-        current = current->next;
     }
 
     return false;
-}
\ No newline at end of file
+}
+
+// ========== SAVE BINARY SECTION ==========
+void HashTable::saveBinary(BinaryWriter &out)
+{
+    out.writeI32(totalAircraft);
+
+    HashSlot *tables[2] = {oldSlots, slots};
+    int sizes[2] = {oldSlots != NULL ? oldMask + 1 : 0, slotMask + 1};
+
+    for (int t = 0; t < 2; t++)
+    {
+        for (int i = 0; i < sizes[t]; i++)
+        {
+            if (tables[t][i].node == NULL)
+            {
+                continue;
+            }
+
+            Aircraft &a = tables[t][i].node->aircraft;
+            out.writeU32(a.flightID);
+            writeDecoded(out, a);
+        }
+    }
+}
+
+// ========== STATE CHECKSUM ==========
+unsigned int HashTable::stateChecksum()
+{
+    // Slot order depends on handle values and rehash progress, so
+    // records are summed
+    unsigned int sum = (unsigned int)totalAircraft;
+    BinaryWriter out;
+
+    HashSlot *tables[2] = {oldSlots, slots};
+    int sizes[2] = {oldSlots != NULL ? oldMask + 1 : 0, slotMask + 1};
+
+    for (int t = 0; t < 2; t++)
+    {
+        for (int i = 0; i < sizes[t]; i++)
+        {
+            if (tables[t][i].node == NULL)
+            {
+                continue;
+            }
+
+            Aircraft &a = tables[t][i].node->aircraft;
+            out.clear();
+            out.writeString(flightIDs().getName(a.flightID));
+            writeDecoded(out, a);
+            sum += checksumBytes(out.getData(), out.getSize());
+        }
+    }
+
+    return sum;
+}
+
+// ========== LOAD BINARY SECTION ==========
+bool HashTable::loadBinary(BinaryReader &in, const HandleRemap &remap)
+{
+    int count = in.readI32();
+    if (!in.ok() || count < 0)
+    {
+        return false;
+    }
+
+    clear();
+    reserve(count);
+
+    // Saved records are unique, so place them without duplicate checks
+    for (int i = 0; i < count && in.ok(); i++)
+    {
+        Aircraft a;
+        a.flightID = remap.map(in.readU32());
+        string model = in.readString();
+        int fuel = in.readI32();
+        string origin = in.readString();
+        string destination = in.readString();
+        string status = in.readString();
+        encodeAircraft(a, model, fuel, origin, destination, status);
+
+        placeNode(slots, slotMask, nodePool.create(a));
+        indexRecord(a);
+        totalAircraft++;
+    }
+
+    return in.ok();
+}
@@ -3,85 +3,296 @@
 
 #include <string>
 #include <iostream>
+#include "IDInterner.h"
+#include "BinaryIO.h"
+#include "RegistryIndex.h"
+#include "NodePool.h"
 
 using namespace std;
 
-const int HASH_TABLE_SIZE = 100;
+class Journal;
+class ChangeFeed;
+
+const int HASH_TABLE_SIZE = 128;      // initial slot count (power of two, doubles as the table fills)
+const int HASH_MAX_LOAD_PERCENT = 75; // grow once more slots than this are used
+const int HASH_REHASH_STEP = 8;       // old slots moved per insert/delete while growing
+const int PROBE_HISTOGRAM_SIZE = 8;   // probe lengths 1..7, then 8 or more
+
+const int MAX_NAME_CODE = 65535; // dictionary codes stored per record
+
+// ========== AIRCRAFT STATUS ==========
+enum AircraftStatus
+{
+    AIRCRAFT_UNKNOWN,
+    AIRCRAFT_GROUNDED,
+    AIRCRAFT_TAXIING,
+    AIRCRAFT_FLYING,
+    AIRCRAFT_HOLDING,
+    AIRCRAFT_APPROACHING,
+    AIRCRAFT_LANDING,
+    AIRCRAFT_LANDED,
+    AIRCRAFT_EMERGENCY,
+    AIRCRAFT_CRASHED
+};
+
+// Status text used at the API, journal and snapshot boundary
+// ("FLYING", "LANDED", ...); unrecognised text parses to AIRCRAFT_UNKNOWN
+AircraftStatus parseAircraftStatus(const string &text);
+const string &aircraftStatusName(AircraftStatus status);
+
+// Dictionaries for registry model and airport names; records keep the
+// dictionary handles as 16-bit codes (0 = none)
+IDInterner &modelNames();
+IDInterner &airportNames();
+
+// ========== REGISTRY FIELDS ==========
+// Record fields that can be indexed and queried
+enum RegistryField
+{
+    FIELD_STATUS,
+    FIELD_ORIGIN,
+    FIELD_DESTINATION,
+    FIELD_MODEL
+};
+const int REGISTRY_FIELDS = 4;
 
 // ========== AIRCRAFT STRUCTURE ==========
+// Packed 12-byte record: model and airports are dictionary codes and
+// status is an AircraftStatus, so a million aircraft take 12 MB of
+// records instead of five strings each. Names are decoded for output.
 struct Aircraft
 {
-    string flightID;
-    string model;
-    int fuel;
-    string origin;
-    string destination;
-    string status;
-
-    Aircraft() : flightID(""), model(""), fuel(0),
-                 origin(""), destination(""), status("") {}
-
-    Aircraft(string id, string m, int f, string org,
-             string dest, string st)
-        : flightID(id), model(m), fuel(f),
-          origin(org), destination(dest), status(st) {}
+    FlightHandle flightID;      // interned flight ID
+    unsigned short model;       // modelNames() code
+    unsigned short origin;      // airportNames() code
+    unsigned short destination; // airportNames() code
+    unsigned char fuel;         // 0-100%
+    unsigned char status;       // AircraftStatus
+
+    Aircraft() : flightID(NO_FLIGHT), model(0), origin(0), destination(0),
+                 fuel(0), status(AIRCRAFT_UNKNOWN) {}
 };
 
-// ========== HASH TABLE NODE (for chaining) ==========
+// ========== HASH TABLE NODE ==========
+// Records live outside the slot array so pointers returned by
+// searchAircraft stay valid while slots move or the table grows
 struct HashNode
 {
     Aircraft aircraft;
-    HashNode *next;
 
-    HashNode() : next(NULL) {}
+    HashNode() {}
 
-    HashNode(Aircraft a) : aircraft(a), next(NULL) {}
+    HashNode(const Aircraft &a) : aircraft(a) {}
+};
+
+// ========== HASH TABLE SLOT ==========
+// All-zero bytes are an empty slot, so tables come from calloc and a
+// large one costs no up-front initialisation
+struct HashSlot
+{
+    FlightHandle flightID; // NO_FLIGHT when empty or moved
+    int probe;             // 1 + distance from the home slot (0 = empty)
+    HashNode *node;
+};
+
+// ========== REGISTRY STATISTICS ==========
+struct RegistryStats
+{
+    int records;
+    int slots;         // current table, plus the old one while growing
+    double loadFactor; // records / slots of the current table
+    bool rehashing;
+    int maxProbe;      // slots examined to reach a record (1 = home slot)
+    double averageProbe;
+    int probeHistogram[PROBE_HISTOGRAM_SIZE]; // records per probe length
+    unsigned long long lookups;
+    unsigned long long hits;
+    unsigned long long misses;
 };
 
 // ========== HASH TABLE CLASS ==========
+// Open addressing with Robin Hood probing: an insert takes the slot of
+// any record closer to its home slot, which keeps probe lengths short
+// and lets a lookup stop as soon as it passes where the key would be.
+// Deletes shift the following records back, so no tombstones build up.
+//
+// Growth is incremental: a table twice the size is allocated and every
+// insert or delete moves HASH_REHASH_STEP slots of the old table into
+// it, so no single insert pays for the whole rehash. Until the move is
+// finished lookups check both tables; slots already moved are left as
+// markers that keep their probe distance so old-table probes still work.
 class HashTable
 {
 private:
-    HashNode *buckets[HASH_TABLE_SIZE];
+    HashSlot *slots; // current table (power-of-two size)
+    int slotMask;
+
+    HashSlot *oldSlots; // table being moved out of (NULL when not growing)
+    int oldMask;
+    int rehashCursor; // next old slot to move
+
     int totalAircraft;
+    NodePool<HashNode> nodePool; // every record node; released in bulk by clear()
+    Journal *journalPtr; // Write-ahead journal (optional)
+    ChangeFeed *feedPtr; // Change-data feed for consumers (optional)
+
+    // Secondary indexes, one per RegistryField (NULL when disabled)
+    AttributeIndex *indexes;
+
+    // Lookup counters (plain increments, so they stay on in production)
+    unsigned long long lookupCount;
+    unsigned long long hitCount;
+
+    // Home slot of a handle (handles are dense, so they are mixed first)
+    static unsigned int hashHandle(FlightHandle flightID);
+
+    // Slot holding a handle in one table (-1 if absent)
+    int findSlot(HashSlot *table, int mask, FlightHandle flightID) const;
+
+    // Robin Hood insert of a record known not to be in the table
+    void placeNode(HashSlot *table, int mask, HashNode *node);
+
+    // Remove a slot by shifting the rest of its cluster back
+    void eraseSlot(HashSlot *table, int mask, int index);
 
-    // Hash function
-    int hashFunction(string flightID);
+    // Find the record node for an interned ID (NULL if absent)
+    HashNode *findNode(FlightHandle flightID);
+
+    // Find the record for an interned ID (no output)
+    Aircraft *findAircraft(FlightHandle flightID);
+
+    // Zeroed (all empty) table of size slots
+    static HashSlot *allocateSlots(int size);
+
+    // Start moving into a table of newSize slots
+    void startRehash(int newSize);
+
+    // Move up to count old slots into the current table
+    void rehashStep(int count);
+
+    // Grow if the table is over its load factor
+    void checkLoad();
+
+    // Size an empty table for count records (bulk load)
+    void reserve(int count);
+
+    // Insert or replace an encoded record; true if it was new
+    bool storeRecord(const Aircraft &record);
+
+    // Change a field, keeping indexes and the change feed in step
+    void setStatus(Aircraft *aircraft, AircraftStatus status);
+    void setFuel(Aircraft *aircraft, int newFuel);
+
+    // Unlink and free a record; false if absent
+    bool removeRecord(FlightHandle flightID);
+
+    // Record fields in text form, as snapshots and checksums store them
+    void writeDecoded(BinaryWriter &out, const Aircraft &a);
+
+    // Index key of a record field, and of a queried value (-1 if no
+    // record can have it)
+    static int fieldKey(const Aircraft &a, RegistryField field);
+    static int valueKey(RegistryField field, const string &value);
+
+    // Link/unlink a record in every index (no-op when disabled)
+    void indexRecord(const Aircraft &a);
+    void unindexRecord(const Aircraft &a);
+
+    // One numbered line of a registry listing
+    void displayRow(int number, const Aircraft &a);
 
 public:
     // Constructor & Destructor
     HashTable();
     ~HashTable();
 
+    // Set journal reference
+    void setJournalReference(Journal *j);
+
+    // Publish every mutation to a change feed (NULL to stop)
+    void setChangeFeed(ChangeFeed *f);
+
     // Insert/Update aircraft
-    void insertAircraft(string flightID, string model, int fuel,
-                        string origin, string destination, string status);
+    void insertAircraft(const string &flightID, const string &model, int fuel,
+                        const string &origin, const string &destination, const string &status);
+
+    // Fill a record's fields from their text form (interns new names)
+    static void encodeAircraft(Aircraft &a, const string &model, int fuel, const string &origin,
+                               const string &destination, const string &status);
+
+    // Forms for a handle and an already encoded record: they never touch
+    // the shared interners and write no output or journal records, so a
+    // ConcurrentRegistry shard may run them while another thread interns.
+    // False if the flight is absent or the value invalid.
+    void insertAircraft(const Aircraft &record);
+    bool updateStatus(FlightHandle flightID, AircraftStatus newStatus);
+    bool updateFuel(FlightHandle flightID, int newFuel);
+    bool deleteAircraft(FlightHandle flightID);
 
     // Search aircraft
-    Aircraft *searchAircraft(string flightID);
+    Aircraft *searchAircraft(const string &flightID);
 
     // Update aircraft status
-    void updateStatus(string flightID, string newStatus);
+    void updateStatus(const string &flightID, const string &newStatus);
 
     // Update fuel level
-    void updateFuel(string flightID, int newFuel);
+    void updateFuel(const string &flightID, int newFuel);
 
     // Delete aircraft
-    bool deleteAircraft(string flightID);
+    bool deleteAircraft(const string &flightID);
 
     // Display all aircraft
     void displayAllAircraft();
 
     // Display specific aircraft
-    void displayAircraft(string flightID);
+    void displayAircraft(const string &flightID);
 
     // Get total aircraft count
     int getTotalAircraft();
 
     // Check if aircraft exists
-    bool exists(string flightID);
+    bool exists(const string &flightID);
+
+    // Copy a record without logging or counting; changes nothing, so
+    // any number of readers may call it at once (see ConcurrentRegistry)
+    bool copyAircraft(FlightHandle flightID, Aircraft &out) const;
 
     void clearScreen();
+
+    // Remove every record (no output)
+    void clear();
+
+    // Binary snapshot section (see Snapshot.h)
+    void saveBinary(BinaryWriter &out);
+    bool loadBinary(BinaryReader &in, const HandleRemap &remap);
+
+    // Secondary indexes on status, origin, destination and model; kept
+    // up to date by every insert, update, delete and load once enabled
+    void enableIndexes();
+    void disableIndexes();
+    bool hasIndexes();
+
+    // Flights whose field has a value (status text or name), optionally
+    // also matching a second field (alsoValue "" = any). Returns the number of matches and
+    // writes up to maxCount of them. With indexes this walks only the
+    // shorter matching list; without, it scans every record.
+    int findMatching(RegistryField field, const string &value,
+                     FlightHandle out[], int maxCount);
+    int findMatching(RegistryField field, const string &value,
+                     RegistryField alsoField, const string &alsoValue,
+                     FlightHandle out[], int maxCount);
+
+    // Print the flights matching a query
+    void displayMatching(RegistryField field, const string &value,
+                         RegistryField alsoField, const string &alsoValue);
+
+    // Occupancy, probe lengths and lookup counters; the probe figures
+    // walk the slot array, the counters are kept on every lookup
+    RegistryStats getStats();
+    void displayStats();
+
+    // Checksum of all records, independent of slot order
+    unsigned int stateChecksum();
 };
 
 #endif // HASHTABLE_H
\ No newline at end of file
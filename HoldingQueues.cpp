@@ -0,0 +1,359 @@
+#include "HoldingQueues.h"
+#include "Logger.h"
+#include <iostream>
+#include <iomanip>
+
+using namespace std;
+
+// ========== COLOR CODES ==========
+const string RED = "\033[31m";
+const string GREEN = "\033[32m";
+const string YELLOW = "\033[33m";
+const string CYAN = "\033[36m";
+const string RESET = "\033[0m";
+const string BOLD = "\033[1m";
+
+// Waiting flights listed per queue by displayQueues
+const int DISPLAYED_WAITING = 8;
+
+// ========== CONSTRUCTOR ==========
+HoldingQueues::HoldingQueues()
+{
+    next = NULL;
+    prev = NULL;
+    queueOf = NULL;
+    capacity = 0;
+
+    reserve(64);
+    clear();
+}
+
+// ========== DESTRUCTOR ==========
+HoldingQueues::~HoldingQueues()
+{
+    delete[] next;
+    delete[] prev;
+    delete[] queueOf;
+}
+
+// ========== GROW PER-FLIGHT ARRAYS ==========
+void HoldingQueues::reserve(int handleCount)
+{
+    if (handleCount <= capacity)
+    {
+        return;
+    }
+
+    int newCapacity = capacity > 0 ? capacity : 64;
+    while (newCapacity < handleCount)
+    {
+        newCapacity *= 2;
+    }
+
+    FlightHandle *newNext = new FlightHandle[newCapacity];
+    FlightHandle *newPrev = new FlightHandle[newCapacity];
+    int *newQueueOf = new int[newCapacity];
+    for (int i = 0; i < newCapacity; i++)
+    {
+        bool old = i < capacity;
+        newNext[i] = old ? next[i] : NO_FLIGHT;
+        newPrev[i] = old ? prev[i] : NO_FLIGHT;
+        newQueueOf[i] = old ? queueOf[i] : -1;
+    }
+
+    delete[] next;
+    delete[] prev;
+    delete[] queueOf;
+
+    next = newNext;
+    prev = newPrev;
+    queueOf = newQueueOf;
+    capacity = newCapacity;
+}
+
+// ========== QUEUE IN USE ==========
+bool HoldingQueues::inUse(int nodeID)
+{
+    return totalHolds[nodeID] > 0 || length[nodeID] > 0;
+}
+
+// ========== HOLD ==========
+bool HoldingQueues::hold(FlightHandle flightID, int nodeID)
+{
+    if (flightID == NO_FLIGHT)
+    {
+        return false;
+    }
+
+    reserve((int)flightID + 1);
+    if (queueOf[flightID] != -1)
+    {
+        return false;
+    }
+
+    if (nodeID < 0 || nodeID >= MAX_NODES)
+    {
+        return false;
+    }
+
+    // Append at the tail so the list stays in hold order
+    prev[flightID] = tail[nodeID];
+    next[flightID] = NO_FLIGHT;
+    if (tail[nodeID] != NO_FLIGHT)
+        next[tail[nodeID]] = flightID;
+    else
+        head[nodeID] = flightID;
+    tail[nodeID] = flightID;
+    queueOf[flightID] = nodeID;
+
+    length[nodeID]++;
+    totalHolds[nodeID]++;
+    if (length[nodeID] > peakLength[nodeID])
+    {
+        peakLength[nodeID] = length[nodeID];
+    }
+    holdingCount++;
+    return true;
+}
+
+// ========== RELEASE ==========
+void HoldingQueues::release(FlightHandle flightID)
+{
+    if (flightID == NO_FLIGHT || (int)flightID >= capacity || queueOf[flightID] == -1)
+    {
+        return;
+    }
+
+    int nodeID = queueOf[flightID];
+
+    if (prev[flightID] != NO_FLIGHT)
+        next[prev[flightID]] = next[flightID];
+    else
+        head[nodeID] = next[flightID];
+
+    if (next[flightID] != NO_FLIGHT)
+        prev[next[flightID]] = prev[flightID];
+    else
+        tail[nodeID] = prev[flightID];
+
+    next[flightID] = NO_FLIGHT;
+    prev[flightID] = NO_FLIGHT;
+    queueOf[flightID] = -1;
+    length[nodeID]--;
+    holdingCount--;
+}
+
+// ========== CLEAR ==========
+void HoldingQueues::clear()
+{
+    for (int i = 0; i < capacity; i++)
+    {
+        next[i] = NO_FLIGHT;
+        prev[i] = NO_FLIGHT;
+        queueOf[i] = -1;
+    }
+    for (int n = 0; n < MAX_NODES; n++)
+    {
+        head[n] = NO_FLIGHT;
+        tail[n] = NO_FLIGHT;
+        length[n] = 0;
+        peakLength[n] = 0;
+        totalHolds[n] = 0;
+    }
+    holdingCount = 0;
+}
+
+// ========== QUERIES ==========
+FlightHandle HoldingQueues::front(int nodeID)
+{
+    return (nodeID >= 0 && nodeID < MAX_NODES) ? head[nodeID] : NO_FLIGHT;
+}
+
+FlightHandle HoldingQueues::nextOf(FlightHandle flightID)
+{
+    if (flightID == NO_FLIGHT || (int)flightID >= capacity)
+    {
+        return NO_FLIGHT;
+    }
+    return next[flightID];
+}
+
+int HoldingQueues::listContested(int out[], int maxCount)
+{
+    int written = 0;
+    for (int n = 0; n < MAX_NODES && written < maxCount; n++)
+    {
+        if (length[n] > 0)
+        {
+            out[written++] = n;
+        }
+    }
+    return written;
+}
+
+int HoldingQueues::getHoldingNode(FlightHandle flightID)
+{
+    if (flightID == NO_FLIGHT || (int)flightID >= capacity || queueOf[flightID] == -1)
+    {
+        return -1;
+    }
+    return queueOf[flightID];
+}
+
+int HoldingQueues::getQueueLength(int nodeID)
+{
+    return (nodeID >= 0 && nodeID < MAX_NODES) ? length[nodeID] : 0;
+}
+
+int HoldingQueues::getPeakLength(int nodeID)
+{
+    return (nodeID >= 0 && nodeID < MAX_NODES) ? peakLength[nodeID] : 0;
+}
+
+long HoldingQueues::getTotalHolds(int nodeID)
+{
+    return (nodeID >= 0 && nodeID < MAX_NODES) ? totalHolds[nodeID] : 0;
+}
+
+int HoldingQueues::getHoldingCount()
+{
+    return holdingCount;
+}
+
+// ========== SAVE BINARY ==========
+void HoldingQueues::saveBinary(BinaryWriter &out)
+{
+    int used = 0;
+    for (int n = 0; n < MAX_NODES; n++)
+    {
+        if (inUse(n))
+        {
+            used++;
+        }
+    }
+    out.writeI32(used);
+
+    for (int n = 0; n < MAX_NODES; n++)
+    {
+        if (!inUse(n))
+        {
+            continue;
+        }
+
+        out.writeI32(n);
+        out.writeI32(peakLength[n]);
+        out.writeU64(totalHolds[n]);
+        out.writeI32(length[n]);
+        for (FlightHandle h = head[n]; h != NO_FLIGHT; h = next[h])
+        {
+            out.writeU32(h);
+        }
+    }
+}
+
+// ========== LOAD BINARY ==========
+bool HoldingQueues::loadBinary(BinaryReader &in, const HandleRemap &remap)
+{
+    clear();
+
+    int count = in.readI32();
+    if (!in.ok() || count < 0 || count > MAX_NODES)
+    {
+        return false;
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        int nodeID = in.readI32();
+        int peak = in.readI32();
+        long holds = (long)in.readU64();
+        int waiting = in.readI32();
+        if (!in.ok() || nodeID < 0 || nodeID >= MAX_NODES || waiting < 0)
+        {
+            return false;
+        }
+
+        // Rejoining in saved order keeps the hold order
+        for (int j = 0; j < waiting && in.ok(); j++)
+        {
+            hold(remap.map(in.readU32()), nodeID);
+        }
+        peakLength[nodeID] = peak;
+        totalHolds[nodeID] = holds;
+    }
+
+    return in.ok();
+}
+
+// ========== WRITE LOGICAL STATE ==========
+void HoldingQueues::writeState(BinaryWriter &out)
+{
+    for (int n = 0; n < MAX_NODES; n++)
+    {
+        if (!inUse(n))
+        {
+            continue;
+        }
+
+        out.writeI32(n);
+        out.writeI32(peakLength[n]);
+        out.writeU64(totalHolds[n]);
+        for (FlightHandle h = head[n]; h != NO_FLIGHT; h = next[h])
+        {
+            out.writeString(flightIDs().getName(h));
+        }
+        out.writeI32(-1);
+    }
+}
+
+// ========== DISPLAY QUEUES ==========
+void HoldingQueues::displayQueues(Graph *graph)
+{
+    logger().flush();
+
+    cout << BOLD << CYAN << "\n+=============================================================+\n";
+    cout << "|                    " << YELLOW << "HOLDING QUEUES" << CYAN << "                           |\n";
+    cout << "+=============================================================+\n"
+         << RESET << endl;
+
+    bool any = false;
+    for (int n = 0; n < MAX_NODES && !any; n++)
+    {
+        any = inUse(n);
+    }
+    if (!any)
+    {
+        cout << GREEN << "  No flight has had to hold\n"
+             << RESET << endl;
+        return;
+    }
+
+    cout << "  Flights Holding: " << (holdingCount > 0 ? RED : GREEN) << holdingCount << RESET << endl
+         << endl;
+
+    for (int n = 0; n < MAX_NODES; n++)
+    {
+        if (!inUse(n))
+        {
+            continue;
+        }
+
+        Node *node = graph != NULL ? graph->getNode(n) : NULL;
+        cout << "  " << BOLD << setw(6) << (node != NULL ? node->name : "?") << RESET
+             << " | Waiting " << (length[n] > 0 ? YELLOW : GREEN) << setw(4) << length[n] << RESET
+             << " | Peak " << setw(4) << peakLength[n]
+             << " | Holds " << setw(6) << totalHolds[n] << endl;
+
+        int shown = 0;
+        for (FlightHandle h = head[n]; h != NO_FLIGHT && shown < DISPLAYED_WAITING; h = next[h])
+        {
+            cout << "         " << shown + 1 << ". " << CYAN << flightIDs().getName(h) << RESET << endl;
+            shown++;
+        }
+        if (length[n] > shown)
+        {
+            cout << "         ... and " << length[n] - shown << " more" << endl;
+        }
+    }
+    cout << endl;
+}
@@ -0,0 +1,81 @@
+#ifndef HOLDING_QUEUES_H
+#define HOLDING_QUEUES_H
+
+#include "Graph.h"
+#include "IDInterner.h"
+#include "BinaryIO.h"
+
+using namespace std;
+
+// ========== HOLDING QUEUES CLASS ==========
+// Flights that find their next node occupied or contested wait in that
+// node's queue instead of failing the move. Each node keeps an intrusive
+// list of handles in the order they started holding, so joining and
+// leaving are O(1) and the list order is a stable tie-break when the
+// owner grants a freed node. Queue length, peak length and holds per
+// node are kept as sector metrics.
+class HoldingQueues
+{
+private:
+    // Queues are indexed by node ID (IDs are 0..MAX_NODES-1); a node's
+    // queue is in use once a flight has held for it
+    FlightHandle head[MAX_NODES];
+    FlightHandle tail[MAX_NODES];
+    int length[MAX_NODES];
+    int peakLength[MAX_NODES];
+    long totalHolds[MAX_NODES];
+    int holdingCount;
+
+    // Per handle: queue links and the node it holds for (-1 = not holding)
+    FlightHandle *next;
+    FlightHandle *prev;
+    int *queueOf;
+    int capacity;
+
+    void reserve(int handleCount);
+
+    // A queue that is or has been in use (listed, saved and displayed)
+    bool inUse(int nodeID);
+
+public:
+    // Constructor & Destructor
+    HoldingQueues();
+    ~HoldingQueues();
+
+    // Join the back of a node's queue; false if already holding
+    bool hold(FlightHandle flightID, int nodeID);
+
+    // Leave whichever queue the flight is in
+    void release(FlightHandle flightID);
+
+    // Drop every queue and metric
+    void clear();
+
+    // Waiting flights of a node in hold order (NO_FLIGHT at the end)
+    FlightHandle front(int nodeID);
+    FlightHandle nextOf(FlightHandle flightID);
+
+    // Nodes with at least one flight waiting; returns how many
+    int listContested(int out[], int maxCount);
+
+    // Node a flight is holding for (-1 when not holding)
+    int getHoldingNode(FlightHandle flightID);
+
+    // Sector metrics
+    int getQueueLength(int nodeID);
+    int getPeakLength(int nodeID);
+    long getTotalHolds(int nodeID);
+    int getHoldingCount();
+
+    // Binary snapshot part of the flights section
+    void saveBinary(BinaryWriter &out);
+    bool loadBinary(BinaryReader &in, const HandleRemap &remap);
+
+    // Logical state (IDs by name) for checksums
+    void writeState(BinaryWriter &out);
+
+    // Print every queue that is or has been in use
+    void displayQueues(Graph *graph);
+};
+
+#endif // HOLDING_QUEUES_H
@@ -0,0 +1,212 @@
+#include "IDInterner.h"
+
+using namespace std;
+
+// ========== SHARED FLIGHT ID INTERNER ==========
+IDInterner &flightIDs()
+{
+    // Constructed on first use so global objects can rely on it
+    static IDInterner interner;
+    return interner;
+}
+
+// ========== HASH FUNCTION (FNV-1a) ==========
+unsigned int IDInterner::hashString(const string &id)
+{
+    unsigned int hash = 2166136261u;
+
+    for (size_t i = 0; i < id.length(); i++)
+    {
+        hash ^= (unsigned char)id[i];
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+// ========== CONSTRUCTOR ==========
+IDInterner::IDInterner()
+{
+    nameCapacity = 64;
+    slotCapacity = 128;
+    nameCount = 1; // Handle 0 is reserved for NO_FLIGHT
+
+    names = new string[nameCapacity];
+    hashes = new unsigned int[nameCapacity];
+    slots = new FlightHandle[slotCapacity];
+
+    hashes[0] = 0;
+    for (int i = 0; i < slotCapacity; i++)
+    {
+        slots[i] = NO_FLIGHT;
+    }
+}
+
+// ========== DESTRUCTOR ==========
+IDInterner::~IDInterner()
+{
+    delete[] names;
+    delete[] hashes;
+    delete[] slots;
+}
+
+// ========== GROW HANDLE ARRAYS ==========
+void IDInterner::growNames()
+{
+    int newCapacity = nameCapacity * 2;
+    string *newNames = new string[newCapacity];
+    unsigned int *newHashes = new unsigned int[newCapacity];
+
+    for (int i = 0; i < nameCount; i++)
+    {
+        newNames[i].swap(names[i]);
+        newHashes[i] = hashes[i];
+    }
+
+    delete[] names;
+    delete[] hashes;
+    names = newNames;
+    hashes = newHashes;
+    nameCapacity = newCapacity;
+}
+
+// ========== GROW SLOT TABLE ==========
+void IDInterner::growSlots()
+{
+    int newCapacity = slotCapacity * 2;
+    FlightHandle *newSlots = new FlightHandle[newCapacity];
+
+    for (int i = 0; i < newCapacity; i++)
+    {
+        newSlots[i] = NO_FLIGHT;
+    }
+
+    // Reinsert every handle using its cached hash (no string work)
+    for (int h = 1; h < nameCount; h++)
+    {
+        int index = hashes[h] & (newCapacity - 1);
+        while (newSlots[index] != NO_FLIGHT)
+        {
+            index = (index + 1) & (newCapacity - 1);
+        }
+        newSlots[index] = h;
+    }
+
+    delete[] slots;
+    slots = newSlots;
+    slotCapacity = newCapacity;
+}
+
+// ========== INTERN ID ==========
+FlightHandle IDInterner::intern(const string &id)
+{
+    if (id.empty())
+    {
+        return NO_FLIGHT;
+    }
+
+    unsigned int hash = hashString(id);
+    int index = hash & (slotCapacity - 1);
+
+    // Linear probing until we find the ID or an empty slot
+    while (slots[index] != NO_FLIGHT)
+    {
+        FlightHandle h = slots[index];
+        if (hashes[h] == hash && names[h] == id)
+        {
+            return h;
+        }
+        index = (index + 1) & (slotCapacity - 1);
+    }
+
+    // New ID: assign the next handle
+    if (nameCount >= nameCapacity)
+    {
+        growNames();
+    }
+
+    FlightHandle handle = nameCount;
+    names[handle] = id;
+    hashes[handle] = hash;
+    nameCount++;
+    slots[index] = handle;
+
+    // Keep load factor below 1/2
+    if (nameCount * 2 > slotCapacity)
+    {
+        growSlots();
+    }
+
+    return handle;
+}
+
+// ========== LOOKUP ID ==========
+FlightHandle IDInterner::lookup(const string &id) const
+{
+    if (id.empty())
+    {
+        return NO_FLIGHT;
+    }
+
+    unsigned int hash = hashString(id);
+    int index = hash & (slotCapacity - 1);
+
+    while (slots[index] != NO_FLIGHT)
+    {
+        FlightHandle h = slots[index];
+        if (hashes[h] == hash && names[h] == id)
+        {
+            return h;
+        }
+        index = (index + 1) & (slotCapacity - 1);
+    }
+
+    return NO_FLIGHT;
+}
+
+// ========== DECODE HANDLE ==========
+const string &IDInterner::getName(FlightHandle handle) const
+{
+    if (handle >= (FlightHandle)nameCount)
+    {
+        return names[0];
+    }
+    return names[handle];
+}
+
+// ========== GET HANDLE COUNT ==========
+int IDInterner::getCount() const
+{
+    return nameCount - 1;
+}
+
+// ========== SAVE BINARY SECTION ==========
+void IDInterner::saveBinary(BinaryWriter &out) const
+{
+    out.writeU32((unsigned int)(nameCount - 1));
+
+    for (int h = 1; h < nameCount; h++)
+    {
+        out.writeString(names[h]);
+    }
+}
+
+// ========== LOAD BINARY SECTION ==========
+bool IDInterner::loadRemap(BinaryReader &in, HandleRemap &remap)
+{
+    unsigned int count = in.readU32();
+
+    // Each entry needs at least its 4-byte length prefix
+    if (!in.ok() || count > in.remaining() / 4)
+    {
+        return false;
+    }
+
+    remap.resize(count);
+    for (unsigned int h = 1; h <= count; h++)
+    {
+        remap.set(h, intern(in.readString()));
+    }
+
+    return in.ok();
+}
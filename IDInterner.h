@@ -0,0 +1,87 @@
+#ifndef IDINTERNER_H
+#define IDINTERNER_H
+
+#include <string>
+#include "BinaryIO.h"
+
+using namespace std;
+
+// Compact handle for an interned flight ID (0 = no flight)
+typedef unsigned int FlightHandle;
+const FlightHandle NO_FLIGHT = 0;
+
+// ========== HANDLE REMAP ==========
+// Translates handles stored in a file into handles of the running interner
+class HandleRemap
+{
+private:
+    FlightHandle *handles;
+    unsigned int count;
+
+public:
+    HandleRemap() : handles(NULL), count(0) {}
+    ~HandleRemap() { delete[] handles; }
+
+    void resize(unsigned int n)
+    {
+        delete[] handles;
+        handles = new FlightHandle[n + 1];
+        handles[0] = NO_FLIGHT;
+        count = n;
+    }
+
+    void set(unsigned int fileHandle, FlightHandle handle) { handles[fileHandle] = handle; }
+
+    // Unknown file handles map to NO_FLIGHT
+    FlightHandle map(unsigned int fileHandle) const
+    {
+        return (fileHandle <= count && handles != NULL) ? handles[fileHandle] : NO_FLIGHT;
+    }
+};
+
+// ========== ID INTERNER CLASS ==========
+// Maps each distinct ID string to a small, dense handle (1, 2, 3, ...)
+// so subsystems store and compare integers instead of strings.
+class IDInterner
+{
+private:
+    string *names;        // handle -> ID string (index 0 unused)
+    unsigned int *hashes; // cached hash per handle
+    FlightHandle *slots;  // open-addressing table of handles (0 = empty)
+    int nameCount;        // number of handles in use, including slot 0
+    int nameCapacity;
+    int slotCapacity; // always a power of two
+
+    // Hash function (FNV-1a)
+    static unsigned int hashString(const string &id);
+
+    // Growth helpers
+    void growNames();
+    void growSlots();
+
+public:
+    // Constructor & Destructor
+    IDInterner();
+    ~IDInterner();
+
+    // Return the handle for an ID, assigning a new one if unseen
+    FlightHandle intern(const string &id);
+
+    // Return the handle for an ID, or NO_FLIGHT if never interned
+    FlightHandle lookup(const string &id) const;
+
+    // Decode a handle back to its ID string ("" for NO_FLIGHT)
+    const string &getName(FlightHandle handle) const;
+
+    // Number of handles assigned (handles are 1..getCount())
+    int getCount() const;
+
+    // Binary snapshot section: every ID in handle order
+    void saveBinary(BinaryWriter &out) const;
+    bool loadRemap(BinaryReader &in, HandleRemap &remap);
+};
+
+// Shared interner for flight IDs used by every subsystem
+IDInterner &flightIDs();
+
+#endif // IDINTERNER_H
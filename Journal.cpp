@@ -0,0 +1,721 @@
+#include "Journal.h"
+#include "Graph.h"
+#include "FlightManager.h"
+#include "HashTable.h"
+#include "Snapshot.h"
+#include "ReplayEngine.h"
+#include "Logger.h"
+#include <iostream>
+#include <chrono>
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+// ========== COLOR CODES ==========
+const string RED = "\033[31m";
+const string GREEN = "\033[32m";
+const string YELLOW = "\033[33m";
+const string CYAN = "\033[36m";
+const string RESET = "\033[0m";
+const string BOLD = "\033[1m";
+
+// File header: magic, version
+const size_t JOURNAL_HEADER_SIZE = 8;
+
+// Record framing: length (4) + op (1) + LSN (8) ... checksum (4)
+const size_t RECORD_PREFIX_SIZE = 13;
+const size_t RECORD_CHECKSUM_SIZE = 4;
+
+// ========== CONSTRUCTOR ==========
+Journal::Journal()
+{
+    file = NULL;
+    archive = NULL;
+    recordStart = 0;
+    nextLSN = 1;
+    checkpointLSN = 0;
+    recordsSinceCheckpoint = 0;
+    recordsSinceChecksum = 0;
+    depth = 0;
+    replaying = false;
+    graphPtr = NULL;
+    flightMgrPtr = NULL;
+    registryPtr = NULL;
+    snapshotPtr = NULL;
+}
+
+// ========== DESTRUCTOR ==========
+Journal::~Journal()
+{
+    if (file != NULL)
+    {
+        // Close the session with a final checksum for replay
+        if (depth == 0 && recordsSinceChecksum > 0)
+        {
+            logChecksum();
+        }
+        commit();
+        fclose(file);
+    }
+
+    if (archive != NULL)
+    {
+        fclose(archive);
+    }
+}
+
+// ========== CLOSE ==========
+void Journal::close()
+{
+    // Buffered records are dropped: they were never acknowledged on disk
+    buffer.clear();
+    if (file != NULL)
+    {
+        fclose(file);
+        file = NULL;
+    }
+    if (archive != NULL)
+    {
+        fclose(archive);
+        archive = NULL;
+    }
+}
+
+// ========== SET REFERENCES ==========
+void Journal::setReferences(Graph *graph, FlightManager *flightMgr,
+                            HashTable *registry, Snapshot *snapshot)
+{
+    graphPtr = graph;
+    flightMgrPtr = flightMgr;
+    registryPtr = registry;
+    snapshotPtr = snapshot;
+}
+
+// ========== START EMPTY JOURNAL FILE ==========
+bool Journal::resetFile()
+{
+    if (file != NULL)
+    {
+        fclose(file);
+    }
+
+    file = fopen(journalFile.c_str(), "wb");
+    if (file == NULL)
+    {
+        return false;
+    }
+
+    unsigned int header[2] = {JOURNAL_MAGIC, JOURNAL_VERSION};
+    fwrite(header, sizeof(header), 1, file);
+    fflush(file);
+    return true;
+}
+
+// ========== OPEN JOURNAL ==========
+bool Journal::open(const string &journalFilename, const string &checkpointFilename)
+{
+    journalFile = journalFilename;
+    checkpointFile = checkpointFilename;
+
+    MappedFile existing;
+    if (!existing.open(journalFile) || existing.getSize() < JOURNAL_HEADER_SIZE)
+    {
+        return resetFile();
+    }
+
+    // Append after the existing records (recover() sets nextLSN)
+    file = fopen(journalFile.c_str(), "ab");
+    return file != NULL;
+}
+
+// ========== OPEN EVENT ARCHIVE ==========
+bool Journal::openArchive(const string &archiveFilename)
+{
+    MappedFile existing;
+    bool fresh = !existing.open(archiveFilename) || existing.getSize() < JOURNAL_HEADER_SIZE;
+    existing.close();
+
+    archive = fopen(archiveFilename.c_str(), fresh ? "wb" : "ab");
+    if (archive == NULL)
+    {
+        return false;
+    }
+
+    if (fresh)
+    {
+        unsigned int header[2] = {JOURNAL_MAGIC, JOURNAL_VERSION};
+        fwrite(header, sizeof(header), 1, archive);
+        fflush(archive);
+    }
+    return true;
+}
+
+// ========== MARK EXTERNAL STATE ==========
+void Journal::markExternalState()
+{
+    if (file == NULL)
+    {
+        return;
+    }
+
+    beginRecord(OP_EXTERNAL_STATE);
+    endRecord();
+    commit();
+}
+
+// ========== OPERATION NESTING ==========
+void Journal::enter()
+{
+    depth++;
+}
+
+void Journal::leave()
+{
+    depth--;
+}
+
+bool Journal::shouldRecord()
+{
+    return depth == 1 && !replaying && file != NULL;
+}
+
+// ========== RECORD FRAMING ==========
+void Journal::beginRecord(JournalOp op)
+{
+    recordStart = buffer.getSize();
+    buffer.writeU32(0); // payload length, patched in endRecord()
+    buffer.writeU8((unsigned char)op);
+    buffer.writeU64(nextLSN++);
+}
+
+void Journal::endRecord()
+{
+    size_t payloadLength = buffer.getSize() - recordStart - RECORD_PREFIX_SIZE;
+    buffer.patchU32(recordStart, (unsigned int)payloadLength);
+
+    // Checksum covers op, LSN and payload
+    const char *body = buffer.getData() + recordStart + 4;
+    buffer.writeU32(checksumBytes(body, buffer.getSize() - recordStart - 4));
+
+    recordsSinceCheckpoint++;
+    recordsSinceChecksum++;
+
+    // Group commit once enough bytes have accumulated
+    if (buffer.getSize() >= JOURNAL_GROUP_BYTES)
+    {
+        commit();
+    }
+}
+
+// ========== RECORD WRITERS ==========
+void Journal::logAddFlight(const string &flightID, int startNodeID, int destNodeID,
+                           int priority, const string &model)
+{
+    beginRecord(OP_ADD_FLIGHT);
+    buffer.writeString(flightID);
+    buffer.writeI32(startNodeID);
+    buffer.writeI32(destNodeID);
+    buffer.writeI32(priority);
+    buffer.writeString(model);
+    endRecord();
+}
+
+void Journal::logFlightOp(JournalOp op, FlightHandle flightID)
+{
+    beginRecord(op);
+    buffer.writeString(flightIDs().getName(flightID));
+    endRecord();
+}
+
+void Journal::logFlightValue(JournalOp op, FlightHandle flightID, int value)
+{
+    beginRecord(op);
+    buffer.writeString(flightIDs().getName(flightID));
+    buffer.writeI32(value);
+    endRecord();
+}
+
+void Journal::logAddNode(int id, const string &name, int x, int y, int type)
+{
+    beginRecord(OP_ADD_NODE);
+    buffer.writeI32(id);
+    buffer.writeString(name);
+    buffer.writeI32(x);
+    buffer.writeI32(y);
+    buffer.writeI32(type);
+    endRecord();
+}
+
+void Journal::logAddEdge(int fromID, int toID, int weight)
+{
+    beginRecord(OP_ADD_EDGE);
+    buffer.writeI32(fromID);
+    buffer.writeI32(toID);
+    buffer.writeI32(weight);
+    endRecord();
+}
+
+void Journal::logRegistryInsert(const string &flightID, const string &model, int fuel,
+                                const string &origin, const string &destination, const string &status)
+{
+    beginRecord(OP_REGISTRY_INSERT);
+    buffer.writeString(flightID);
+    buffer.writeString(model);
+    buffer.writeI32(fuel);
+    buffer.writeString(origin);
+    buffer.writeString(destination);
+    buffer.writeString(status);
+    endRecord();
+}
+
+void Journal::logRegistryStatus(const string &flightID, const string &status)
+{
+    beginRecord(OP_REGISTRY_STATUS);
+    buffer.writeString(flightID);
+    buffer.writeString(status);
+    endRecord();
+}
+
+void Journal::logRegistryDelete(const string &flightID)
+{
+    beginRecord(OP_REGISTRY_DELETE);
+    buffer.writeString(flightID);
+    endRecord();
+}
+
+void Journal::logTick()
+{
+    beginRecord(OP_TICK);
+    endRecord();
+}
+
+void Journal::logChecksum()
+{
+    if (file == NULL || replaying || graphPtr == NULL ||
+        flightMgrPtr == NULL || registryPtr == NULL)
+    {
+        return;
+    }
+
+    // Reset first: endRecord() may group-commit, which checks this count
+    recordsSinceChecksum = 0;
+
+    beginRecord(OP_STATE_CHECKSUM);
+    buffer.writeU32(computeStateChecksum(*graphPtr, *flightMgrPtr, *registryPtr));
+    buffer.writeU64((unsigned long long)chrono::duration_cast<chrono::milliseconds>(
+                        chrono::system_clock::now().time_since_epoch())
+                        .count());
+    endRecord();
+
+    recordsSinceChecksum = 0;
+}
+
+// ========== WRITE BUFFERED RECORDS ==========
+void Journal::writeBuffer()
+{
+    fwrite(buffer.getData(), 1, buffer.getSize(), file);
+    fflush(file);
+
+    if (archive != NULL)
+    {
+        fwrite(buffer.getData(), 1, buffer.getSize(), archive);
+        fflush(archive);
+    }
+
+    buffer.clear();
+}
+
+// ========== GROUP COMMIT ==========
+void Journal::commit()
+{
+    // Periodic checksum, taken at a group commit between operations so
+    // a bulk command costs one checksum rather than one per interval
+    if (file != NULL && depth == 0 && recordsSinceChecksum >= JOURNAL_CHECKSUM_INTERVAL)
+    {
+        logChecksum();
+    }
+
+    if (file == NULL || buffer.getSize() == 0)
+    {
+        return;
+    }
+
+    writeBuffer();
+#ifndef _WIN32
+    fsync(fileno(file));
+#endif
+
+    // Only checkpoint between operations, never halfway through one
+    if (depth == 0 && recordsSinceCheckpoint >= JOURNAL_CHECKPOINT_INTERVAL)
+    {
+        checkpoint();
+    }
+}
+
+// ========== CHECKPOINT ==========
+bool Journal::checkpoint()
+{
+    if (snapshotPtr == NULL || file == NULL)
+    {
+        return false;
+    }
+
+    // Everything up to the last LSN must be on disk before the snapshot claims it
+    if (buffer.getSize() > 0)
+    {
+        writeBuffer();
+    }
+
+    if (!snapshotPtr->save(checkpointFile, getLastLSN()))
+    {
+        return false;
+    }
+
+    // The snapshot now covers every record, so the journal can start over
+    checkpointLSN = getLastLSN();
+    recordsSinceCheckpoint = 0;
+
+    LOG_INFO << CYAN << "[CHECKPOINT]" << RESET << " State checkpointed at LSN "
+             << checkpointLSN;
+    return resetFile();
+}
+
+// ========== GET LAST LSN ==========
+unsigned long long Journal::getLastLSN()
+{
+    return nextLSN - 1;
+}
+
+// ========== APPLY ONE RECORD ==========
+bool Journal::applyRecord(JournalOp op, BinaryReader &in)
+{
+    switch (op)
+    {
+    case OP_ADD_FLIGHT:
+    {
+        string flightID = in.readString();
+        int startNodeID = in.readI32();
+        int destNodeID = in.readI32();
+        int priority = in.readI32();
+        string model = in.readString();
+        return in.ok() && flightMgrPtr->addFlight(flightID, startNodeID, destNodeID, priority, model);
+    }
+    case OP_REMOVE_FLIGHT:
+    {
+        string flightID = in.readString();
+        return in.ok() && flightMgrPtr->removeFlight(flightID);
+    }
+    case OP_MOVE_FLIGHT:
+    {
+        string flightID = in.readString();
+        return in.ok() && flightMgrPtr->moveFlightToNextNode(flightID);
+    }
+    case OP_UPDATE_FUEL:
+    {
+        string flightID = in.readString();
+        int fuel = in.readI32();
+        return in.ok() && flightMgrPtr->updateFuel(flightID, fuel);
+    }
+    case OP_SET_PRIORITY:
+    {
+        string flightID = in.readString();
+        int priority = in.readI32();
+        return in.ok() && flightMgrPtr->declareEmergency(flightID, priority);
+    }
+    case OP_LAND_FLIGHT:
+    {
+        string flightID = in.readString();
+        return in.ok() && flightMgrPtr->landFlight(flightID);
+    }
+    case OP_ADD_NODE:
+    {
+        int id = in.readI32();
+        string name = in.readString();
+        int x = in.readI32();
+        int y = in.readI32();
+        int type = in.readI32();
+        if (in.ok())
+        {
+            graphPtr->addNode(id, name, x, y, static_cast<NodeType>(type));
+        }
+        return in.ok();
+    }
+    case OP_ADD_EDGE:
+    {
+        int fromID = in.readI32();
+        int toID = in.readI32();
+        int weight = in.readI32();
+        if (in.ok())
+        {
+            graphPtr->addEdge(fromID, toID, weight);
+        }
+        return in.ok();
+    }
+    case OP_REGISTRY_INSERT:
+    {
+        string flightID = in.readString();
+        string model = in.readString();
+        int fuel = in.readI32();
+        string origin = in.readString();
+        string destination = in.readString();
+        string status = in.readString();
+        if (in.ok())
+        {
+            registryPtr->insertAircraft(flightID, model, fuel, origin, destination, status);
+        }
+        return in.ok();
+    }
+    case OP_REGISTRY_STATUS:
+    {
+        string flightID = in.readString();
+        string status = in.readString();
+        if (in.ok())
+        {
+            registryPtr->updateStatus(flightID, status);
+        }
+        return in.ok();
+    }
+    case OP_REGISTRY_FUEL:
+    {
+        string flightID = in.readString();
+        int fuel = in.readI32();
+        if (in.ok())
+        {
+            registryPtr->updateFuel(flightID, fuel);
+        }
+        return in.ok();
+    }
+    case OP_REGISTRY_DELETE:
+    {
+        string flightID = in.readString();
+        return in.ok() && registryPtr->deleteAircraft(flightID);
+    }
+    case OP_TICK:
+        flightMgrPtr->tick();
+        return true;
+    case OP_DIVERT_FLIGHT:
+    {
+        string flightID = in.readString();
+        int destination = in.readI32();
+        return in.ok() && flightMgrPtr->divertFlight(flightID, destination);
+    }
+    case OP_STATE_CHECKSUM:
+    case OP_EXTERNAL_STATE:
+        // Markers only; nothing to re-execute
+        return true;
+    }
+
+    return false;
+}
+
+// ========== RECOVER ==========
+bool Journal::recover()
+{
+    if (graphPtr == NULL || flightMgrPtr == NULL || registryPtr == NULL)
+    {
+        LOG_ERROR << RED << "[ERROR]" << RESET << " Journal references not set!";
+        return false;
+    }
+
+    // 1. Restore the last checkpoint, if any
+    MappedFile checkpointData;
+    if (snapshotPtr != NULL && checkpointData.open(checkpointFile))
+    {
+        checkpointData.close();
+        if (!snapshotPtr->load(checkpointFile))
+        {
+            // The journal tail only makes sense on top of the checkpoint
+            LOG_ERROR << RED << "[ERROR]" << RESET << " Checkpoint " << checkpointFile
+                      << " could not be loaded - journal not replayed";
+            close();
+            return false;
+        }
+        checkpointLSN = snapshotPtr->getCheckpointLSN();
+    }
+
+    // 2. Replay the journal tail
+    MappedFile log;
+    if (!log.open(journalFile) || log.getSize() < JOURNAL_HEADER_SIZE)
+    {
+        nextLSN = checkpointLSN + 1;
+        return true;
+    }
+
+    log.close();
+
+    JournalReader reader;
+    if (!reader.open(journalFile))
+    {
+        LOG_ERROR << RED << "[ERROR]" << RESET << " " << journalFile << " is not a journal file";
+        close();
+        return false;
+    }
+
+    unsigned long long lastLSN = checkpointLSN;
+    int replayed = 0;
+    int failed = 0;
+    JournalRecord record;
+
+    {
+        // Record output is not useful during replay
+        QuietConsole quiet;
+        replaying = true;
+
+        while (reader.next(record))
+        {
+            // Records already covered by the checkpoint are skipped
+            if (record.lsn <= checkpointLSN)
+            {
+                continue;
+            }
+
+            lastLSN = record.lsn;
+            if (record.op == OP_STATE_CHECKSUM || record.op == OP_EXTERNAL_STATE)
+            {
+                continue;
+            }
+
+            BinaryReader payload(record.payload, record.length);
+            if (applyRecord(record.op, payload))
+            {
+                replayed++;
+            }
+            else
+            {
+                failed++;
+            }
+        }
+
+        replaying = false;
+    }
+
+    size_t pos = reader.getValidLength();
+    size_t size = reader.getFileSize();
+    reader.close();
+
+    nextLSN = lastLSN + 1;
+
+    // Drop a torn tail so new records follow the last valid one
+    if (pos < size)
+    {
+        MappedFile valid;
+        valid.open(journalFile);
+        string prefix(valid.getData(), pos);
+        valid.close();
+        if (file != NULL)
+        {
+            fclose(file);
+        }
+        writeWholeFile(journalFile, prefix.data(), prefix.size());
+        file = fopen(journalFile.c_str(), "ab");
+
+        LOG_WARNING << YELLOW << "[WARNING]" << RESET << " Discarded "
+                    << (size - pos) << " bytes of incomplete journal records";
+    }
+
+    if (failed > 0)
+    {
+        LOG_WARNING << GREEN << "[RECOVERY]" << RESET << " Replayed " << CYAN << replayed
+                    << RESET << " journal records after checkpoint LSN " << checkpointLSN
+                    << " (" << RED << failed << " failed" << RESET << ")";
+    }
+    else
+    {
+        LOG_INFO << GREEN << "[RECOVERY]" << RESET << " Replayed " << CYAN << replayed
+                 << RESET << " journal records after checkpoint LSN " << checkpointLSN;
+    }
+
+    // Mark the recovered state so replays can verify it
+    logChecksum();
+    commit();
+
+    return true;
+}
+
+// ========== READER: CONSTRUCTOR ==========
+JournalReader::JournalReader()
+{
+    pos = 0;
+}
+
+// ========== READER: OPEN ==========
+bool JournalReader::open(const string &filename)
+{
+    pos = 0;
+    if (!file.open(filename) || file.getSize() < JOURNAL_HEADER_SIZE)
+    {
+        file.close();
+        return false;
+    }
+
+    BinaryReader header(file.getData(), file.getSize());
+    if (header.readU32() != JOURNAL_MAGIC || header.readU32() != JOURNAL_VERSION)
+    {
+        file.close();
+        return false;
+    }
+
+    pos = JOURNAL_HEADER_SIZE;
+    return true;
+}
+
+// ========== READER: NEXT RECORD ==========
+bool JournalReader::next(JournalRecord &record)
+{
+    const char *data = file.getData();
+    size_t size = file.getSize();
+
+    if (data == NULL || pos + RECORD_PREFIX_SIZE + RECORD_CHECKSUM_SIZE > size)
+    {
+        return false;
+    }
+
+    BinaryReader frame(data + pos, size - pos);
+    unsigned int payloadLength = frame.readU32();
+    unsigned char op = frame.readU8();
+    unsigned long long lsn = frame.readU64();
+
+    // A torn or corrupt record marks the end of the valid log
+    if (payloadLength > size - pos - RECORD_PREFIX_SIZE - RECORD_CHECKSUM_SIZE)
+    {
+        return false;
+    }
+
+    size_t recordSize = RECORD_PREFIX_SIZE + payloadLength + RECORD_CHECKSUM_SIZE;
+    const char *body = data + pos + 4;
+    size_t bodyLength = recordSize - 4 - RECORD_CHECKSUM_SIZE;
+    BinaryReader trailer(body + bodyLength, RECORD_CHECKSUM_SIZE);
+    if (trailer.readU32() != checksumBytes(body, bodyLength))
+    {
+        return false;
+    }
+
+    record.op = static_cast<JournalOp>(op);
+    record.lsn = lsn;
+    record.payload = data + pos + RECORD_PREFIX_SIZE;
+    record.length = payloadLength;
+
+    pos += recordSize;
+    return true;
+}
+
+// ========== READER: POSITION ==========
+size_t JournalReader::getValidLength()
+{
+    return pos;
+}
+
+size_t JournalReader::getFileSize()
+{
+    return file.getSize();
+}
+
+// ========== READER: CLOSE ==========
+void JournalReader::close()
+{
+    file.close();
+    pos = 0;
+}
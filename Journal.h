@@ -0,0 +1,245 @@
+#ifndef JOURNAL_H
+#define JOURNAL_H
+
+#include <string>
+#include <cstdio>
+#include <iostream>
+#include "IDInterner.h"
+#include "BinaryIO.h"
+#include "Logger.h"
+
+using namespace std;
+
+class Graph;
+class FlightManager;
+class HashTable;
+class Snapshot;
+
+const unsigned int JOURNAL_MAGIC = 0x4A435441; // "ATCJ" on disk
+const unsigned int JOURNAL_VERSION = 1;
+
+// Group commit: flush once this many bytes are buffered
+const size_t JOURNAL_GROUP_BYTES = 64 * 1024;
+
+// Take a checkpoint after this many journaled records
+const int JOURNAL_CHECKPOINT_INTERVAL = 10000;
+
+// Record a state checksum at the first group commit after this many records
+const int JOURNAL_CHECKSUM_INTERVAL = 256;
+
+// ========== JOURNALED OPERATIONS ==========
+enum JournalOp
+{
+    OP_ADD_FLIGHT = 1,
+    OP_REMOVE_FLIGHT,
+    OP_MOVE_FLIGHT,
+    OP_UPDATE_FUEL,
+    OP_SET_PRIORITY,
+    OP_LAND_FLIGHT,
+    OP_ADD_NODE,
+    OP_ADD_EDGE,
+    OP_REGISTRY_INSERT,
+    OP_REGISTRY_STATUS,
+    OP_REGISTRY_FUEL,
+    OP_REGISTRY_DELETE,
+    OP_STATE_CHECKSUM, // { checksum, wall-clock ms } for replay verification
+    OP_EXTERNAL_STATE, // state was replaced outside the journal (snapshot load)
+    OP_TICK,
+    OP_DIVERT_FLIGHT
+};
+
+// ========== JOURNAL RECORD ==========
+struct JournalRecord
+{
+    JournalOp op;
+    unsigned long long lsn;
+    const char *payload;
+    unsigned int length;
+};
+
+// ========== JOURNAL READER ==========
+// Iterates the valid records of a journal file; stops at the first
+// torn or corrupt record.
+class JournalReader
+{
+private:
+    MappedFile file;
+    size_t pos;
+
+public:
+    // Constructor
+    JournalReader();
+
+    // Map a journal file and check its header
+    bool open(const string &filename);
+
+    // Read the next valid record; false at the end of the valid log
+    bool next(JournalRecord &record);
+
+    // Bytes of valid records read so far, and total file size
+    size_t getValidLength();
+    size_t getFileSize();
+
+    // Release the mapping
+    void close();
+};
+
+// ========== QUIET CONSOLE ==========
+// Silences the logger and discards anything written to cout while in scope
+class QuietConsole
+{
+private:
+    class NullBuffer : public streambuf
+    {
+    protected:
+        int overflow(int c) { return c; }
+        streamsize xsputn(const char *, streamsize n) { return n; }
+    };
+
+    NullBuffer sink;
+    streambuf *console;
+    LogLevel level;
+
+public:
+    QuietConsole()
+    {
+        logger().flush();
+        level = logger().getLevel();
+        logger().setLevel(LEVEL_QUIET);
+        console = cout.rdbuf(&sink);
+    }
+
+    ~QuietConsole()
+    {
+        cout.rdbuf(console);
+        logger().setLevel(level);
+    }
+};
+
+// ========== JOURNAL CLASS ==========
+// Write-ahead log of every mutating operation.
+//
+// Record layout: { payload length, op, LSN, payload, checksum }.
+// Records are buffered in memory and written out in groups; recovery
+// loads the last checkpoint snapshot and replays only records whose
+// LSN is newer than the checkpoint.
+class Journal
+{
+private:
+    FILE *file;
+    FILE *archive; // full event log, never truncated by checkpoints
+    string journalFile;
+    string checkpointFile;
+
+    BinaryWriter buffer;  // records waiting for group commit
+    size_t recordStart;   // offset of the record being built
+    unsigned long long nextLSN;
+    unsigned long long checkpointLSN;
+    int recordsSinceCheckpoint;
+    int recordsSinceChecksum;
+
+    int depth;      // nesting of journaled operations
+    bool replaying; // true while applying records
+
+    Graph *graphPtr;
+    FlightManager *flightMgrPtr;
+    HashTable *registryPtr;
+    Snapshot *snapshotPtr;
+
+    // Record framing
+    void beginRecord(JournalOp op);
+    void endRecord();
+
+    // Write buffered records to the journal and archive
+    void writeBuffer();
+
+    // Append a state checksum record
+    void logChecksum();
+
+    // Start an empty journal file
+    bool resetFile();
+
+public:
+    // Constructor & Destructor
+    Journal();
+    ~Journal();
+
+    // Objects that records are applied to / checkpointed from
+    void setReferences(Graph *graph, FlightManager *flightMgr,
+                       HashTable *registry, Snapshot *snapshot);
+
+    // Open (or create) the journal; returns false if it cannot be written
+    bool open(const string &journalFilename, const string &checkpointFilename);
+
+    // Also append every record to a never-truncated event log (see ReplayEngine)
+    bool openArchive(const string &archiveFilename);
+
+    // Note that state was replaced outside the journal (e.g. a snapshot load)
+    void markExternalState();
+
+    // Re-execute one record against the referenced objects
+    bool applyRecord(JournalOp op, BinaryReader &in);
+
+    // Load the checkpoint and replay the journal tail; on failure the
+    // journal is closed and its files are left untouched
+    bool recover();
+
+    // Stop journaling without writing anything further
+    void close();
+
+    // Group commit: write buffered records and sync to disk
+    void commit();
+
+    // Snapshot current state and truncate the journal
+    bool checkpoint();
+
+    // Operation nesting (only the outermost operation is journaled)
+    void enter();
+    void leave();
+    bool shouldRecord();
+
+    // Record writers
+    void logAddFlight(const string &flightID, int startNodeID, int destNodeID,
+                      int priority, const string &model);
+    void logFlightOp(JournalOp op, FlightHandle flightID);
+    void logFlightValue(JournalOp op, FlightHandle flightID, int value);
+    void logAddNode(int id, const string &name, int x, int y, int type);
+    void logAddEdge(int fromID, int toID, int weight);
+    void logRegistryInsert(const string &flightID, const string &model, int fuel,
+                           const string &origin, const string &destination, const string &status);
+    void logRegistryStatus(const string &flightID, const string &status);
+    void logRegistryDelete(const string &flightID);
+    void logTick();
+
+    // LSN of the most recent record
+    unsigned long long getLastLSN();
+};
+
+// ========== JOURNAL SCOPE ==========
+// Marks one public operation; nested calls made by it are not journaled.
+class JournalScope
+{
+private:
+    Journal *journal;
+
+public:
+    JournalScope(Journal *j) : journal(j)
+    {
+        if (journal != NULL)
+            journal->enter();
+    }
+
+    ~JournalScope()
+    {
+        if (journal != NULL)
+            journal->leave();
+    }
+
+    // True when this operation should append a record
+    bool recording()
+    {
+        return journal != NULL && journal->shouldRecord();
+    }
+};
+
+#endif // JOURNAL_H
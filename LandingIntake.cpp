@@ -0,0 +1,98 @@
+#include "LandingIntake.h"
+
+using namespace std;
+
+// ========== CONSTRUCTOR ==========
+LandingIntake::LandingIntake()
+    : enqueuePos(0), rejected(0), dequeuePos(0)
+{
+    slots = new IntakeSlot[INTAKE_RING_SIZE];
+    for (size_t i = 0; i < INTAKE_RING_SIZE; i++)
+    {
+        slots[i].sequence.store(i, memory_order_relaxed);
+        slots[i].request.flightID = NO_FLIGHT;
+        slots[i].request.priority = 0;
+    }
+}
+
+// ========== DESTRUCTOR ==========
+LandingIntake::~LandingIntake()
+{
+    delete[] slots;
+}
+
+// ========== PUSH REQUEST ==========
+bool LandingIntake::push(FlightHandle flightID, int priority)
+{
+    // Claim a slot: its sequence equals our position when it is free
+    size_t pos = enqueuePos.load(memory_order_relaxed);
+    IntakeSlot *slot;
+    while (true)
+    {
+        slot = &slots[pos & (INTAKE_RING_SIZE - 1)];
+        size_t sequence = slot->sequence.load(memory_order_acquire);
+        long diff = (long)sequence - (long)pos;
+
+        if (diff == 0)
+        {
+            if (enqueuePos.compare_exchange_weak(pos, pos + 1, memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            // Slot not yet handed back: the ring is full
+            rejected.fetch_add(1, memory_order_relaxed);
+            return false;
+        }
+        else
+        {
+            pos = enqueuePos.load(memory_order_relaxed);
+        }
+    }
+
+    slot->request.flightID = flightID;
+    slot->request.priority = priority;
+    slot->sequence.store(pos + 1, memory_order_release);
+    return true;
+}
+
+// ========== DRAIN REQUESTS ==========
+int LandingIntake::drain(LandingRequest out[], int maxCount)
+{
+    size_t pos = dequeuePos.load(memory_order_relaxed);
+    int count = 0;
+
+    while (count < maxCount)
+    {
+        IntakeSlot *slot = &slots[pos & (INTAKE_RING_SIZE - 1)];
+        if (slot->sequence.load(memory_order_acquire) != pos + 1)
+        {
+            break;
+        }
+
+        out[count++] = slot->request;
+
+        // Hand the slot back to producers one lap later
+        slot->sequence.store(pos + INTAKE_RING_SIZE, memory_order_release);
+        pos++;
+    }
+
+    dequeuePos.store(pos, memory_order_relaxed);
+    return count;
+}
+
+// ========== PENDING COUNT ==========
+size_t LandingIntake::getPending() const
+{
+    size_t head = dequeuePos.load(memory_order_relaxed);
+    size_t tail = enqueuePos.load(memory_order_relaxed);
+    return tail > head ? tail - head : 0;
+}
+
+// ========== REJECTED COUNT ==========
+unsigned long long LandingIntake::getRejected() const
+{
+    return rejected.load(memory_order_relaxed);
+}
@@ -0,0 +1,76 @@
+#ifndef LANDING_INTAKE_H
+#define LANDING_INTAKE_H
+
+#include <atomic>
+#include <cstddef>
+#include "IDInterner.h"
+
+using namespace std;
+
+// Ring slots (must be a power of two)
+const size_t INTAKE_RING_SIZE = 4096;
+
+// Requests the sequencer takes per drain
+const int INTAKE_BATCH = 256;
+
+// Keeps the producer and consumer positions on different cache lines
+const size_t INTAKE_PAD = 64;
+
+// ========== LANDING REQUEST ==========
+struct LandingRequest
+{
+    FlightHandle flightID;
+    int priority; // 1=Critical, 2=Low Fuel, 3=Normal, 4=Low
+};
+
+// ========== INTAKE SLOT ==========
+struct IntakeSlot
+{
+    atomic<size_t> sequence; // ring position this slot is ready for
+    LandingRequest request;
+};
+
+// ========== LANDING INTAKE CLASS ==========
+// Lock-free bounded queue of landing requests. Any number of approach
+// control threads push; the one sequencer thread that owns the landing
+// queue drains them in batches, in the order they were claimed.
+//
+// Same slot protocol as the logger's ring: a producer claims a position
+// with one compare-and-swap and publishes by storing position + 1 in
+// the slot; the sequencer hands the slot back one lap later. A full
+// ring rejects the push instead of waiting, so producers never block on
+// the sequencer.
+class LandingIntake
+{
+private:
+    IntakeSlot *slots;
+
+    atomic<size_t> enqueuePos; // next ring position for producers
+    atomic<unsigned long long> rejected;
+    char producerPad[INTAKE_PAD];
+    atomic<size_t> dequeuePos; // next ring position for the sequencer
+    char consumerPad[INTAKE_PAD];
+
+    // Not copyable
+    LandingIntake(const LandingIntake &other);
+    LandingIntake &operator=(const LandingIntake &other);
+
+public:
+    // Constructor & Destructor
+    LandingIntake();
+    ~LandingIntake();
+
+    // Queue one request (any thread); false if the ring is full
+    bool push(FlightHandle flightID, int priority);
+
+    // Take up to maxCount requests (sequencer thread only)
+    int drain(LandingRequest out[], int maxCount);
+
+    // Requests waiting (approximate while producers are pushing)
+    size_t getPending() const;
+
+    // Pushes turned away because the ring was full
+    unsigned long long getRejected() const;
+};
+
+#endif // LANDING_INTAKE_H
@@ -0,0 +1,94 @@
+#ifndef LANDING_QUEUE_H
+#define LANDING_QUEUE_H
+
+#include <string>
+#include <iostream>
+#include "IDInterner.h"
+#include "BinaryIO.h"
+
+using namespace std;
+
+const int LANDING_PRIORITIES = 4; // 1=Critical, 2=Low Fuel, 3=Normal, 4=Low
+
+// Landing order key, most significant first:
+// priority (4 bits) | ETA tick (28 bits) | enqueue sequence (32 bits)
+const int KEY_PRIORITY_SHIFT = 60;
+const int KEY_ETA_SHIFT = 32;
+const int KEY_MAX_ETA = 0x0FFFFFFF;
+const unsigned long long KEY_SEQUENCE_MASK = 0xFFFFFFFFULL;
+
+// ========== FLIGHT STRUCTURE FOR LANDING QUEUE ==========
+struct Flight
+{
+    FlightHandle flightID; // interned flight ID
+    int priority;          // 1=Critical, 2=Low Fuel, 3=Normal, 4=Low
+    int eta;               // tick the flight reached its approach
+
+    Flight() : flightID(NO_FLIGHT), priority(4), eta(0) {}
+
+    Flight(FlightHandle id, int p, int e = 0) : flightID(id), priority(p), eta(e) {}
+
+    // Decoded flight ID string
+    const string &getID() const
+    {
+        return flightIDs().getName(flightID);
+    }
+
+    void display()
+    {
+        cout << "Flight: " << getID() << " | Priority: " << priority;
+    }
+};
+
+// ========== LANDING QUEUE INTERFACE ==========
+// What the flight manager, snapshots and menus need from the landing
+// queue. MinHeap (4-ary heap) and BucketQueue (one list per priority)
+// both implement it and share the snapshot section format, so either
+// can be chosen at start-up and load the other's snapshots.
+//
+// Both land flights in the same order: by priority, then ETA, then the
+// order they were queued. A priority change keeps the flight's ETA and
+// queue order, so an emergency does not lose its place among flights
+// that arrived after it. ETAs are clamped to 0..KEY_MAX_ETA.
+class LandingQueue
+{
+public:
+    virtual ~LandingQueue() {}
+
+    // Queue a flight (priority 1-4) with its estimated arrival tick
+    virtual void insert(const string &flightID, int priority) = 0;
+    virtual void insert(FlightHandle flightID, int priority, int eta = 0) = 0;
+
+    // Take the flight that lands next
+    virtual Flight extractMin() = 0;
+
+    // Change priority of a queued flight (emergency override)
+    virtual void updatePriority(const string &flightID, int newPriority) = 0;
+    virtual void updatePriority(FlightHandle flightID, int newPriority) = 0;
+
+    // Take a flight out of the queue wherever it is; false if not queued
+    virtual bool remove(FlightHandle flightID) = 0;
+
+    // Check if a flight is queued
+    virtual bool contains(FlightHandle flightID) = 0;
+
+    // Display landing queue in landing order
+    virtual void displayQueue() = 0;
+
+    // Flight that lands next, without removing it
+    virtual Flight getNextFlight() = 0;
+
+    virtual bool isEmpty() = 0;
+    virtual int getSize() = 0;
+
+    // Copy up to maxCount queued flights into out in landing order
+    virtual int listInOrder(Flight out[], int maxCount) = 0;
+
+    // Binary snapshot section: count, then { handle, priority, eta,
+    // sequence } in landing order. The enqueue sequence is kept so ties
+    // resolve the same way after a load as before it
+    virtual void saveBinary(BinaryWriter &out) = 0;
+    virtual bool loadBinary(BinaryReader &in, const HandleRemap &remap) = 0;
+};
+
+#endif // LANDING_QUEUE_H
@@ -0,0 +1,233 @@
+#include "Logger.h"
+#include <iostream>
+#include <cstdlib>
+#include <chrono>
+
+using namespace std;
+
+// Writer batches are written out once they reach this size
+const size_t LOG_BATCH_BYTES = 64 * 1024;
+
+// ========== SHARED LOGGER ==========
+static void shutdownLogger()
+{
+    logger().shutdown();
+}
+
+static Logger *createLogger()
+{
+    Logger *instance = new Logger();
+    atexit(shutdownLogger);
+    return instance;
+}
+
+Logger &logger()
+{
+    // Never destroyed: destructors of global objects may still log at exit.
+    // The writer is drained and stopped by an atexit handler instead.
+    static Logger *instance = createLogger();
+    return *instance;
+}
+
+// ========== PARSE LEVEL NAME ==========
+bool parseLogLevel(const string &name, LogLevel &result)
+{
+    if (name == "debug")
+        result = LEVEL_DEBUG;
+    else if (name == "info")
+        result = LEVEL_INFO;
+    else if (name == "warning")
+        result = LEVEL_WARNING;
+    else if (name == "error")
+        result = LEVEL_ERROR;
+    else if (name == "quiet")
+        result = LEVEL_QUIET;
+    else
+        return false;
+
+    return true;
+}
+
+// ========== CONSTRUCTOR ==========
+Logger::Logger()
+{
+    level.store(LEVEL_INFO);
+
+    slots = new LogSlot[LOG_RING_SIZE];
+    for (size_t i = 0; i < LOG_RING_SIZE; i++)
+    {
+        slots[i].sequence.store(i, memory_order_relaxed);
+    }
+
+    enqueuePos.store(0);
+    dequeuePos = 0;
+    written.store(0);
+    writerSleeping.store(false);
+    running.store(true);
+
+    writer = thread(&Logger::writerLoop, this);
+}
+
+// ========== DESTRUCTOR ==========
+Logger::~Logger()
+{
+    shutdown();
+    delete[] slots;
+}
+
+// ========== LEVEL CONTROL ==========
+void Logger::setLevel(LogLevel newLevel)
+{
+    level.store(newLevel);
+}
+
+LogLevel Logger::getLevel() const
+{
+    return static_cast<LogLevel>(level.load());
+}
+
+// ========== WAKE WRITER ==========
+void Logger::wakeWriter()
+{
+    if (writerSleeping.load(memory_order_acquire))
+    {
+        wake.notify_one();
+    }
+}
+
+// ========== QUEUE MESSAGE ==========
+void Logger::write(LogLevel messageLevel, string &text)
+{
+    if (!isEnabled(messageLevel))
+    {
+        return;
+    }
+
+    // Writer already stopped (program exit): write directly
+    if (!running.load(memory_order_acquire))
+    {
+        cout << text << '\n';
+        cout.flush();
+        return;
+    }
+
+    // Claim a slot: its sequence equals our position when it is free
+    size_t pos = enqueuePos.load(memory_order_relaxed);
+    LogSlot *slot;
+    while (true)
+    {
+        slot = &slots[pos & (LOG_RING_SIZE - 1)];
+        size_t sequence = slot->sequence.load(memory_order_acquire);
+        long diff = (long)sequence - (long)pos;
+
+        if (diff == 0)
+        {
+            if (enqueuePos.compare_exchange_weak(pos, pos + 1, memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            // Ring is full: let the writer catch up
+            wakeWriter();
+            this_thread::yield();
+            pos = enqueuePos.load(memory_order_relaxed);
+        }
+        else
+        {
+            pos = enqueuePos.load(memory_order_relaxed);
+        }
+    }
+
+    slot->text.swap(text);
+    slot->sequence.store(pos + 1, memory_order_release);
+    wakeWriter();
+}
+
+// ========== TAKE NEXT MESSAGE ==========
+bool Logger::pop(string &text)
+{
+    LogSlot *slot = &slots[dequeuePos & (LOG_RING_SIZE - 1)];
+    if (slot->sequence.load(memory_order_acquire) != dequeuePos + 1)
+    {
+        return false;
+    }
+
+    text.swap(slot->text);
+    slot->text.clear();
+
+    // Hand the slot back to producers one lap later
+    slot->sequence.store(dequeuePos + LOG_RING_SIZE, memory_order_release);
+    dequeuePos++;
+    return true;
+}
+
+// ========== WRITER THREAD ==========
+void Logger::writerLoop()
+{
+    string batch;
+    string text;
+
+    while (true)
+    {
+        size_t count = 0;
+        batch.clear();
+
+        while (batch.size() < LOG_BATCH_BYTES && pop(text))
+        {
+            batch += text;
+            batch += '\n';
+            count++;
+        }
+
+        if (count > 0)
+        {
+            cout.write(batch.data(), batch.size());
+            cout.flush();
+            written.fetch_add(count, memory_order_release);
+            continue;
+        }
+
+        if (!running.load(memory_order_acquire))
+        {
+            break;
+        }
+
+        // Idle: sleep until a producer wakes us (or a short timeout)
+        unique_lock<mutex> lock(wakeMutex);
+        writerSleeping.store(true, memory_order_release);
+        wake.wait_for(lock, chrono::milliseconds(10));
+        writerSleeping.store(false, memory_order_release);
+    }
+}
+
+// ========== FLUSH ==========
+void Logger::flush()
+{
+    if (!running.load(memory_order_acquire))
+    {
+        return;
+    }
+
+    size_t target = enqueuePos.load(memory_order_acquire);
+    while (written.load(memory_order_acquire) < target)
+    {
+        wakeWriter();
+        this_thread::yield();
+    }
+}
+
+// ========== SHUTDOWN ==========
+void Logger::shutdown()
+{
+    if (!writer.joinable())
+    {
+        return;
+    }
+
+    flush();
+    running.store(false, memory_order_release);
+    wake.notify_one();
+    writer.join();
+}
@@ -0,0 +1,123 @@
+#ifndef LOGGER_H
+#define LOGGER_H
+
+#include <string>
+#include <sstream>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+using namespace std;
+
+// Ring buffer slots (must be a power of two)
+const size_t LOG_RING_SIZE = 4096;
+
+// ========== LOG LEVELS ==========
+enum LogLevel
+{
+    LEVEL_DEBUG,   // per-move detail (node occupancy, ...)
+    LEVEL_INFO,    // normal operation messages
+    LEVEL_WARNING, // alerts, collisions, emergencies
+    LEVEL_ERROR,   // rejected operations
+    LEVEL_QUIET    // no output at all
+};
+
+// ========== LOG SLOT ==========
+struct LogSlot
+{
+    atomic<size_t> sequence; // ring position this slot is ready for
+    string text;
+};
+
+// ========== LOGGER CLASS ==========
+// Leveled console logger. Messages below the current level are never
+// formatted; enabled messages are pushed onto a lock-free ring buffer
+// (any number of producers, one consumer) and written out in batches by
+// a background thread, so callers never wait on console I/O.
+class Logger
+{
+private:
+    atomic<int> level;
+
+    LogSlot *slots;
+    atomic<size_t> enqueuePos; // next ring position for producers
+    size_t dequeuePos;         // next ring position for the writer
+    atomic<size_t> written;    // messages already written out
+
+    thread writer;
+    atomic<bool> running;
+    atomic<bool> writerSleeping;
+    mutex wakeMutex;
+    condition_variable wake;
+
+    // Background thread body
+    void writerLoop();
+
+    // Take the next ready message (writer thread only)
+    bool pop(string &text);
+
+    void wakeWriter();
+
+public:
+    // Constructor & Destructor
+    Logger();
+    ~Logger();
+
+    // Level control
+    void setLevel(LogLevel newLevel);
+    LogLevel getLevel() const;
+    bool isEnabled(LogLevel messageLevel) const
+    {
+        return messageLevel >= level.load(memory_order_relaxed);
+    }
+
+    // Queue one message (a newline is appended)
+    void write(LogLevel messageLevel, string &text);
+
+    // Block until every queued message has been written
+    void flush();
+
+    // Drain and stop the writer; later messages are written directly
+    void shutdown();
+};
+
+// Shared logger used by every subsystem
+Logger &logger();
+
+// Parse "debug", "info", "warning", "error" or "quiet"
+bool parseLogLevel(const string &name, LogLevel &result);
+
+// ========== LOG LINE ==========
+// Collects one message and queues it when the statement ends.
+class LogLine
+{
+private:
+    LogLevel messageLevel;
+    ostringstream buffer;
+
+public:
+    LogLine(LogLevel l) : messageLevel(l) {}
+    ~LogLine()
+    {
+        string text = buffer.str();
+        logger().write(messageLevel, text);
+    }
+
+    ostream &stream() { return buffer; }
+};
+
+// Usage: LOG_INFO << "Flight " << id << " added";
+// Arguments are not evaluated when the level is disabled.
+#define LOG_AT(lvl)                     \
+    if (!logger().isEnabled(lvl))       \
+        ;                               \
+    else                                \
+        LogLine(lvl).stream()
+
+#define LOG_DEBUG LOG_AT(LEVEL_DEBUG)
+#define LOG_INFO LOG_AT(LEVEL_INFO)
+#define LOG_WARNING LOG_AT(LEVEL_WARNING)
+#define LOG_ERROR LOG_AT(LEVEL_ERROR)
+
+#endif // LOGGER_H
@@ -1,6 +1,10 @@
 #include "MinHeap.h"
+#include "Logger.h"
 #include <iostream>
 #include <iomanip>
+#include <cstdlib>
+#include <cstdint>
+#include <new>
 
 using namespace std;
 
@@ -17,122 +21,263 @@ MinHeap::MinHeap()
 {
     size = 0;
     // Array is 1-indexed, so we start from index 1
-    cout << GREEN << "[SUCCESS] Landing Queue initialized" << RESET << endl;
+    capacity = INITIAL_QUEUE_CAPACITY;
+    flights = allocateEntries(capacity, block);
+    nextSequence = 0;
+
+    positionCapacity = 64;
+    position = new int[positionCapacity];
+    for (int i = 0; i < positionCapacity; i++)
+    {
+        position[i] = 0;
+    }
+
+    LOG_DEBUG << "[LANDING] Landing Queue initialized";
+}
+
+// ========== COPY CONSTRUCTOR ==========
+MinHeap::MinHeap(const MinHeap &other)
+{
+    size = other.size;
+    capacity = other.capacity;
+    flights = allocateEntries(capacity, block);
+    nextSequence = other.nextSequence;
+    for (int i = 1; i <= size; i++)
+    {
+        flights[i] = other.flights[i];
+    }
+
+    positionCapacity = other.positionCapacity;
+    position = new int[positionCapacity];
+    for (int i = 0; i < positionCapacity; i++)
+    {
+        position[i] = other.position[i];
+    }
 }
 
 // ========== DESTRUCTOR ==========
 MinHeap::~MinHeap()
 {
-    // Nothing to delete - array is static
+    free(block);
+    delete[] position;
+}
+
+// ========== ALLOCATE ALIGNED ENTRIES ==========
+HeapEntry *MinHeap::allocateEntries(int count, void *&raw)
+{
+    // Children of entry i are 4i-2 .. 4i+1, so sibling groups start at
+    // indexes 2, 6, 10, ...; shift the array so index 2 starts a line
+    const int lead = HEAP_ARITY - 2;
+    size_t bytes = (count + 1 + lead) * sizeof(HeapEntry) + HEAP_CACHE_LINE;
+
+    raw = malloc(bytes);
+    if (raw == NULL)
+    {
+        throw bad_alloc();
+    }
+
+    uintptr_t line = ((uintptr_t)raw + HEAP_CACHE_LINE - 1) & ~(uintptr_t)(HEAP_CACHE_LINE - 1);
+    return (HeapEntry *)line + lead;
+}
+
+// ========== GROW HEAP ARRAY ==========
+void MinHeap::reserve(int count)
+{
+    if (count <= capacity)
+    {
+        return;
+    }
+
+    int newCapacity = capacity;
+    while (newCapacity < count)
+    {
+        newCapacity *= 2;
+    }
+
+    void *newBlock;
+    HeapEntry *newFlights = allocateEntries(newCapacity, newBlock);
+    for (int i = 1; i <= size; i++)
+    {
+        newFlights[i] = flights[i];
+    }
+
+    free(block);
+    flights = newFlights;
+    block = newBlock;
+    capacity = newCapacity;
+}
+
+// ========== GROW POSITION MAP ==========
+void MinHeap::reservePositions(int handleCount)
+{
+    if (handleCount <= positionCapacity)
+    {
+        return;
+    }
+
+    int newCapacity = positionCapacity;
+    while (newCapacity < handleCount)
+    {
+        newCapacity *= 2;
+    }
+
+    int *newPosition = new int[newCapacity];
+    for (int i = 0; i < newCapacity; i++)
+    {
+        newPosition[i] = (i < positionCapacity) ? position[i] : 0;
+    }
+
+    delete[] position;
+    position = newPosition;
+    positionCapacity = newCapacity;
 }
 
 // ========== GET PARENT INDEX ==========
 int MinHeap::getParent(int index)
 {
-    return index / 2;
+    return (index - 2) / HEAP_ARITY + 1;
 }
 
-// ========== GET LEFT CHILD INDEX ==========
-int MinHeap::getLeft(int index)
+// ========== GET FIRST CHILD INDEX ==========
+int MinHeap::getFirstChild(int index)
 {
-    return 2 * index;
+    return HEAP_ARITY * (index - 1) + 2;
 }
 
-// ========== GET RIGHT CHILD INDEX ==========
-int MinHeap::getRight(int index)
+// ========== CHECK WHICH HAS HIGHER PRIORITY ==========
+bool MinHeap::hasHigherPriority(const HeapEntry &a, const HeapEntry &b)
 {
-    return 2 * index + 1;
+    // Lower priority number first, then earlier ETA, then queued first
+    return a.key < b.key;
 }
 
-// ========== CHECK WHICH HAS HIGHER PRIORITY ==========
-bool MinHeap::hasHigherPriority(Flight a, Flight b)
+// ========== BUILD LANDING KEY ==========
+unsigned long long MinHeap::makeKey(int priority, int eta, unsigned int sequence)
 {
-    // Lower priority number = higher priority
-    return a.priority < b.priority;
+    if (eta < 0)
+        eta = 0;
+    else if (eta > KEY_MAX_ETA)
+        eta = KEY_MAX_ETA;
+
+    return ((unsigned long long)priority << KEY_PRIORITY_SHIFT) |
+           ((unsigned long long)eta << KEY_ETA_SHIFT) |
+           sequence;
 }
 
 // ========== HEAPIFY UP ==========
 void MinHeap::heapifyUp(int index)
 {
-    // Move element up until heap property is satisfied
+    // Carry the entry up, moving each lower-priority parent down into
+    // the hole, and write it (and its position) once at the end
+    HeapEntry moving = flights[index];
+
     while (index > 1)
     {
         int parentIndex = getParent(index);
 
-        // If current has higher priority than parent, swap
-        if (hasHigherPriority(flights[index], flights[parentIndex]))
-        {
-            // Swap
-            Flight temp = flights[index];
-            flights[index] = flights[parentIndex];
-            flights[parentIndex] = temp;
-
-            index = parentIndex;
-        }
-        else
+        if (!hasHigherPriority(moving, flights[parentIndex]))
         {
             break;
         }
+
+        flights[index] = flights[parentIndex];
+        position[flights[index].flightID] = index;
+        index = parentIndex;
     }
+
+    flights[index] = moving;
+    position[moving.flightID] = index;
 }
 
 // ========== HEAPIFY DOWN ==========
 void MinHeap::heapifyDown(int index)
 {
-    // Move element down until heap property is satisfied
+    // Carry the entry down, moving the best child up into the hole
+    HeapEntry moving = flights[index];
+
     while (true)
     {
-        int leftIndex = getLeft(index);
-        int rightIndex = getRight(index);
-        int smallest = index;
-
-        // Check if left child has higher priority
-        if (leftIndex <= size && hasHigherPriority(flights[leftIndex], flights[smallest]))
+        int firstChild = getFirstChild(index);
+        if (firstChild > size)
         {
-            smallest = leftIndex;
+            break;
         }
 
-        // Check if right child has higher priority
-        if (rightIndex <= size && hasHigherPriority(flights[rightIndex], flights[smallest]))
+        // Pick the child with the highest priority (one cache line)
+        int lastChild = min(firstChild + HEAP_ARITY - 1, size);
+        int best = firstChild;
+        for (int child = firstChild + 1; child <= lastChild; child++)
         {
-            smallest = rightIndex;
+            if (hasHigherPriority(flights[child], flights[best]))
+            {
+                best = child;
+            }
         }
 
-        // If smallest is not current node, swap and continue
-        if (smallest != index)
-        {
-            Flight temp = flights[index];
-            flights[index] = flights[smallest];
-            flights[smallest] = temp;
-
-            index = smallest;
-        }
-        else
+        if (!hasHigherPriority(flights[best], moving))
         {
             break;
         }
+
+        flights[index] = flights[best];
+        position[flights[index].flightID] = index;
+        index = best;
+    }
+
+    flights[index] = moving;
+    position[moving.flightID] = index;
+}
+
+// ========== BUILD HEAP (BOTTOM-UP) ==========
+void MinHeap::buildHeap()
+{
+    if (size < 2)
+    {
+        return;
+    }
+
+    // Sift down every entry that has children, deepest first
+    for (int index = getParent(size); index >= 1; index--)
+    {
+        heapifyDown(index);
     }
 }
 
 // ========== INSERT FLIGHT INTO HEAP ==========
-void MinHeap::insert(string flightID, int priority)
+void MinHeap::insert(const string &flightID, int priority)
+{
+    insert(flightIDs().intern(flightID), priority);
+}
+
+void MinHeap::insert(FlightHandle flightID, int priority, int eta)
 {
-    if (size >= MAX_FLIGHTS)
+    if (flightID == NO_FLIGHT)
     {
-        cout << RED << "[ERROR]" << RESET << " Landing queue is full!" << endl;
+        LOG_ERROR << RED << "[ERROR]" << RESET << " Invalid flight!";
         return;
     }
 
     // Validate priority
     if (priority < 1 || priority > 4)
     {
-        cout << RED << "[ERROR]" << RESET << " Invalid priority! Use 1-4" << endl;
+        LOG_ERROR << RED << "[ERROR]" << RESET << " Invalid priority! Use 1-4";
+        return;
+    }
+
+    if (contains(flightID))
+    {
+        LOG_ERROR << RED << "[ERROR]" << RESET << " Flight " << CYAN << flightIDs().getName(flightID)
+                  << RESET << " is already in the landing queue";
         return;
     }
 
     // Add flight at the end
+    reserve(size + 1);
+    reservePositions((int)flightID + 1);
     size++;
-    flights[size] = Flight(flightID, priority);
+    flights[size].key = makeKey(priority, eta, nextSequence++);
+    flights[size].flightID = flightID;
+    position[flightID] = size;
 
     // Restore heap property
     heapifyUp(size);
@@ -147,8 +292,8 @@ void MinHeap::insert(string flightID, int priority)
     else
         priorityName = "LOW";
 
-    cout << GREEN << "[INSERT]" << RESET << " Flight " << CYAN << flightID
-         << RESET << " added to queue [" << YELLOW << priorityName << RESET << "]" << endl;
+    LOG_DEBUG << GREEN << "[INSERT]" << RESET << " Flight " << CYAN << flightIDs().getName(flightID)
+              << RESET << " added to queue [" << YELLOW << priorityName << RESET << "]";
 }
 
 // ========== EXTRACT MINIMUM (LAND FLIGHT) ==========
@@ -156,20 +301,22 @@ Flight MinHeap::extractMin()
 {
     if (size == 0)
     {
-        cout << RED << "[ERROR]" << RESET << " Landing queue is empty!" << endl;
-        return Flight("", -1);
+        LOG_ERROR << RED << "[ERROR]" << RESET << " Landing queue is empty!";
+        return Flight(NO_FLIGHT, -1);
     }
 
     // Get the flight with highest priority
-    Flight minFlight = flights[1];
+    Flight minFlight(flights[1].flightID, flights[1].getPriority(), flights[1].getETA());
+    position[minFlight.flightID] = 0;
 
-    // Move last flight to root
-    flights[1] = flights[size];
+    // Move last flight to root (unless the root was the last flight)
     size--;
-
-    // Restore heap property
     if (size > 0)
     {
+        flights[1] = flights[size + 1];
+        position[flights[1].flightID] = 1;
+
+        // Restore heap property
         heapifyDown(1);
     }
 
@@ -177,35 +324,34 @@ Flight MinHeap::extractMin()
 }
 
 // ========== UPDATE PRIORITY (EMERGENCY OVERRIDE) ==========
-void MinHeap::updatePriority(string flightID, int newPriority)
+void MinHeap::updatePriority(const string &flightID, int newPriority)
+{
+    updatePriority(flightIDs().lookup(flightID), newPriority);
+}
+
+void MinHeap::updatePriority(FlightHandle flightID, int newPriority)
 {
     if (newPriority < 1 || newPriority > 4)
     {
-        cout << RED << "[ERROR]" << RESET << " Invalid priority! Use 1-4" << endl;
+        LOG_ERROR << RED << "[ERROR]" << RESET << " Invalid priority! Use 1-4";
         return;
     }
 
-    // Find the flight
-    int index = -1;
-    for (int i = 1; i <= size; i++)
-    {
-        if (flights[i].flightID == flightID)
-        {
-            index = i;
-            break;
-        }
-    }
+    // Find the flight through the position map
+    int index = contains(flightID) ? position[flightID] : -1;
 
     if (index == -1)
     {
-        cout << RED << "[ERROR]" << RESET << " Flight " << CYAN << flightID
-             << RESET << " not found in queue" << endl;
+        LOG_ERROR << RED << "[ERROR]" << RESET << " Flight " << CYAN << flightIDs().getName(flightID)
+                  << RESET << " not found in queue";
         return;
     }
 
-    // Update priority
-    int oldPriority = flights[index].priority;
-    flights[index].priority = newPriority;
+    // Update priority; ETA and queue order are kept, so the flight
+    // lands among its new class in the order it arrived
+    int oldPriority = flights[index].getPriority();
+    unsigned long long arrival = flights[index].key & ((1ULL << KEY_PRIORITY_SHIFT) - 1);
+    flights[index].key = ((unsigned long long)newPriority << KEY_PRIORITY_SHIFT) | arrival;
 
     // Restore heap property
     if (newPriority < oldPriority)
@@ -229,8 +375,43 @@ void MinHeap::updatePriority(string flightID, int newPriority)
     else
         priorityName = "LOW";
 
-    cout << YELLOW << "[EMERGENCY]" << RESET << " Flight " << CYAN << flightID
-         << RESET << " priority updated to " << RED << priorityName << RESET << endl;
+    LOG_DEBUG << YELLOW << "[EMERGENCY]" << RESET << " Flight " << CYAN << flightIDs().getName(flightID)
+              << RESET << " priority updated to " << RED << priorityName << RESET;
+}
+
+// ========== REMOVE FLIGHT FROM QUEUE ==========
+bool MinHeap::remove(FlightHandle flightID)
+{
+    if (!contains(flightID))
+    {
+        return false;
+    }
+
+    int index = position[flightID];
+    position[flightID] = 0;
+
+    // Fill the hole with the last entry and restore heap order from there
+    if (index != size)
+    {
+        flights[index] = flights[size];
+        position[flights[index].flightID] = index;
+        size--;
+
+        heapifyUp(index);
+        heapifyDown(index);
+    }
+    else
+    {
+        size--;
+    }
+
+    return true;
+}
+
+// ========== CHECK IF FLIGHT IS QUEUED ==========
+bool MinHeap::contains(FlightHandle flightID)
+{
+    return flightID != NO_FLIGHT && (int)flightID < positionCapacity && position[flightID] != 0;
 }
 
 // ========== GET NEXT FLIGHT TO LAND ==========
@@ -238,11 +419,11 @@ Flight MinHeap::getNextFlight()
 {
     if (size == 0)
     {
-        cout << RED << "[ERROR]" << RESET << " Landing queue is empty!" << endl;
-        return Flight("", -1);
+        LOG_ERROR << RED << "[ERROR]" << RESET << " Landing queue is empty!";
+        return Flight(NO_FLIGHT, -1);
     }
 
-    return flights[1];
+    return Flight(flights[1].flightID, flights[1].getPriority(), flights[1].getETA());
 }
 
 // ========== CHECK IF HEAP IS EMPTY ==========
@@ -257,9 +438,23 @@ int MinHeap::getSize()
     return size;
 }
 
+// ========== LIST IN LANDING ORDER ==========
+int MinHeap::listInOrder(Flight out[], int maxCount)
+{
+    MinHeap ordered = *this;
+    int count = 0;
+    while (ordered.size > 0 && count < maxCount)
+    {
+        out[count++] = ordered.extractMin();
+    }
+    return count;
+}
+
 // ========== DISPLAY LANDING QUEUE ==========
 void MinHeap::displayQueue()
 {
+    logger().flush();
+
     cout << BOLD << CYAN << "\n+=============================================================+\n";
     cout << "|              " << YELLOW << "LANDING PRIORITY QUEUE" << CYAN << "                     |\n";
     cout << "+=============================================================+\n"
@@ -311,11 +506,78 @@ void MinHeap::displayQueue()
         }
 
         cout << BOLD << "  " << setw(2) << position << ". " << RESET
-             << CYAN << setw(12) << current.flightID << RESET << " | "
-             << priorityColor << BOLD << setw(12) << priorityName << RESET << endl;
+             << CYAN << setw(12) << current.getID() << RESET << " | "
+             << priorityColor << BOLD << setw(12) << priorityName << RESET
+             << " | ETA tick " << current.eta << endl;
 
         position++;
     }
 
     cout << endl;
-}
\ No newline at end of file
+}
+
+// ========== SAVE BINARY SECTION ==========
+void MinHeap::saveBinary(BinaryWriter &out)
+{
+    // Written in landing order
+    out.writeI32(size);
+
+    MinHeap ordered = *this;
+    while (ordered.size > 0)
+    {
+        unsigned int sequence = (unsigned int)(ordered.flights[1].key & KEY_SEQUENCE_MASK);
+        Flight current = ordered.extractMin();
+        out.writeU32(current.flightID);
+        out.writeI32(current.priority);
+        out.writeI32(current.eta);
+        out.writeU32(sequence);
+    }
+}
+
+// ========== LOAD BINARY SECTION ==========
+bool MinHeap::loadBinary(BinaryReader &in, const HandleRemap &remap)
+{
+    int count = in.readI32();
+    if (!in.ok() || count < 0 || (size_t)count > in.remaining() / 16)
+    {
+        return false;
+    }
+
+    for (int i = 1; i <= size; i++)
+    {
+        position[flights[i].flightID] = 0;
+    }
+
+    size = 0;
+    nextSequence = 0;
+    reserve(count);
+    reservePositions(flightIDs().getCount() + 1);
+    for (int i = 1; i <= count && in.ok(); i++)
+    {
+        FlightHandle flightID = remap.map(in.readU32());
+        int priority = in.readI32();
+        int eta = in.readI32();
+        unsigned int sequence = in.readU32();
+        if (flightID == NO_FLIGHT || (int)flightID >= positionCapacity || position[flightID] != 0 ||
+            priority < 1 || priority > LANDING_PRIORITIES)
+        {
+            return false;
+        }
+
+        // Keep the saved sequence so later priority changes tie-break as before
+        flights[i].key = makeKey(priority, eta, sequence);
+        flights[i].flightID = flightID;
+        if (sequence >= nextSequence)
+        {
+            nextSequence = sequence + 1;
+        }
+        position[flightID] = i;
+        size++;
+    }
+
+    // Bulk construction: O(n), and nothing moves when the section was
+    // written in landing order
+    buildHeap();
+
+    return in.ok();
+}
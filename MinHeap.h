@@ -3,55 +3,98 @@
 
 #include <string>
 #include <iostream>
+#include "LandingQueue.h"
 
 using namespace std;
 
-const int MAX_FLIGHTS = 100;
+const int INITIAL_QUEUE_CAPACITY = 100; // grows on demand
 
-// ========== FLIGHT STRUCTURE FOR HEAP ==========
-struct Flight
-{
-    string flightID;
-    int priority; // 1=Critical, 2=Low Fuel, 3=Normal, 4=Low
-
-    Flight() : flightID(""), priority(4) {}
+// 4-ary heap: the four children of an entry fill one 64-byte cache line
+const int HEAP_ARITY = 4;
+const int HEAP_CACHE_LINE = 64;
 
-    Flight(string id, int p) : flightID(id), priority(p) {}
+// ========== HEAP ENTRY ==========
+// One queued flight: the whole landing order lives in one integer (key
+// layout in LandingQueue.h), so
+// comparing two entries is a single unsigned compare. 16 bytes, so a
+// group of four siblings is exactly one cache line.
+struct HeapEntry
+{
+    unsigned long long key;
+    FlightHandle flightID;
 
-    void display()
-    {
-        cout << "Flight: " << flightID << " | Priority: " << priority;
-    }
+    int getPriority() const { return (int)(key >> KEY_PRIORITY_SHIFT); }
+    int getETA() const { return (int)((key >> KEY_ETA_SHIFT) & KEY_MAX_ETA); }
 };
 
 // ========== MIN HEAP CLASS ==========
-class MinHeap
+// Landing queue ordered by priority, then estimated arrival, then the
+// order flights were queued, so equal flights land first come, first
+// served and a long-waiting flight cannot be starved. A position map
+// from flight handle to heap index is kept up to date on every move,
+// so priority changes and removal of a queued flight are O(log n) with
+// no search.
+//
+// The heap is 4-ary and the array is placed so that every group of
+// siblings starts on a cache line: sifting down reads one line per
+// level, and the tree is half as deep as a binary heap.
+class MinHeap : public LandingQueue
 {
 private:
-    Flight flights[MAX_FLIGHTS]; // 1-indexed array
+    HeapEntry *flights; // Growable 1-indexed array
+    void *block;        // allocation behind flights (for alignment)
     int size;
+    int capacity;
+
+    // Handle -> heap index (0 when not queued)
+    int *position;
+    int positionCapacity;
+
+    // Aligned storage for count entries; raw receives the allocation
+    HeapEntry *allocateEntries(int count, void *&raw);
+
+    // Grow storage for count flights / handles below handleCount
+    void reserve(int count);
+    void reservePositions(int handleCount);
 
     // Helper functions
     void heapifyUp(int index);
     void heapifyDown(int index);
     int getParent(int index);
-    int getLeft(int index);
-    int getRight(int index);
-    bool hasHigherPriority(Flight a, Flight b);
+    int getFirstChild(int index);
+
+    // Restore heap order over the whole array bottom-up in O(n)
+    void buildHeap();
+    bool hasHigherPriority(const HeapEntry &a, const HeapEntry &b);
+
+    // Next enqueue sequence number (restored when a snapshot is loaded)
+    unsigned int nextSequence;
+
+    // Pack priority, ETA and an enqueue sequence number into a key
+    unsigned long long makeKey(int priority, int eta, unsigned int sequence);
 
 public:
     // Constructor & Destructor
     MinHeap();
+    MinHeap(const MinHeap &other);
     ~MinHeap();
 
     // Insert flight into queue
-    void insert(string flightID, int priority);
+    void insert(const string &flightID, int priority);
+    void insert(FlightHandle flightID, int priority, int eta = 0);
 
     // Extract minimum priority flight (land it)
     Flight extractMin();
 
     // Change priority of flight (emergency override)
-    void updatePriority(string flightID, int newPriority);
+    void updatePriority(const string &flightID, int newPriority);
+    void updatePriority(FlightHandle flightID, int newPriority);
+
+    // Take a flight out of the queue wherever it is; false if not queued
+    bool remove(FlightHandle flightID);
+
+    // Check if a flight is queued
+    bool contains(FlightHandle flightID);
 
     // Display landing queue
     void displayQueue();
@@ -64,6 +107,17 @@ public:
 
     // Get heap size
     int getSize();
+
+    // Queued flights in landing order
+    int listInOrder(Flight out[], int maxCount);
+
+    // Binary snapshot section (see Snapshot.h)
+    void saveBinary(BinaryWriter &out);
+    bool loadBinary(BinaryReader &in, const HandleRemap &remap);
+
+private:
+    // Not assignable (copy construction is used for ordered listing only)
+    MinHeap &operator=(const MinHeap &other);
 };
 
 #endif // MINHEAP_H
\ No newline at end of file
@@ -0,0 +1,132 @@
+#ifndef NODE_POOL_H
+#define NODE_POOL_H
+
+#include <cstdlib>
+#include <new>
+
+using namespace std;
+
+const int POOL_FIRST_CHUNK = 64;  // nodes in a pool's first chunk
+const int POOL_MAX_CHUNK = 4096;  // chunks double up to this many nodes
+
+// ========== NODE POOL CLASS ==========
+// Fixed-size block allocator for the nodes of one structure. Nodes are
+// carved out of large chunks by bumping a pointer, so consecutive
+// inserts sit next to each other in memory; destroyed nodes go on a
+// free list and are reused first. releaseAll() hands every chunk back
+// in one pass instead of freeing nodes one at a time.
+//
+// Each chunk is an array of blocks whose first block links to the
+// previous chunk. Not thread-safe: a pool belongs to one structure.
+template <class T>
+class NodePool
+{
+private:
+    // A free block holds the free-list link, a used one holds a T
+    union Block
+    {
+        Block *next;
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+    Block *chunks;    // newest chunk (NULL if none)
+    Block *bump;      // next never-used block in the newest chunk
+    Block *bumpEnd;   // end of the newest chunk
+    Block *freeList;  // destroyed blocks, reused first
+    int nextChunkSize;
+    int liveCount;
+    size_t reservedBytes;
+
+    // No copies: two pools must never share chunks
+    NodePool(const NodePool &);
+    NodePool &operator=(const NodePool &);
+
+    // Raw storage for one node
+    void *allocate()
+    {
+        if (freeList != NULL)
+        {
+            Block *block = freeList;
+            freeList = block->next;
+            return block;
+        }
+
+        if (bump == bumpEnd)
+        {
+            // Block 0 is the chunk link, the rest are nodes
+            Block *chunk = (Block *)malloc((nextChunkSize + 1) * sizeof(Block));
+            if (chunk == NULL)
+            {
+                throw bad_alloc();
+            }
+            chunk[0].next = chunks;
+            chunks = chunk;
+            bump = chunk + 1;
+            bumpEnd = chunk + 1 + nextChunkSize;
+            reservedBytes += (nextChunkSize + 1) * sizeof(Block);
+
+            if (nextChunkSize < POOL_MAX_CHUNK)
+            {
+                nextChunkSize *= 2;
+            }
+        }
+
+        return bump++;
+    }
+
+public:
+    // Constructor & Destructor
+    NodePool() : chunks(NULL), bump(NULL), bumpEnd(NULL), freeList(NULL),
+                 nextChunkSize(POOL_FIRST_CHUNK), liveCount(0), reservedBytes(0) {}
+    ~NodePool() { releaseAll(); }
+
+    // Construct a node from one argument (its only constructor form here)
+    template <class A>
+    T *create(const A &arg)
+    {
+        T *node = new (allocate()) T(arg);
+        liveCount++;
+        return node;
+    }
+
+    // Destroy one node and keep its block for reuse
+    void destroy(T *node)
+    {
+        if (node == NULL)
+        {
+            return;
+        }
+
+        node->~T();
+        Block *block = reinterpret_cast<Block *>(node);
+        block->next = freeList;
+        freeList = block;
+        liveCount--;
+    }
+
+    // Free every chunk at once. Destructors of nodes still alive are not
+    // run, so callers either destroy them first or use a node type with
+    // nothing to destruct.
+    void releaseAll()
+    {
+        while (chunks != NULL)
+        {
+            Block *previous = chunks[0].next;
+            free(chunks);
+            chunks = previous;
+        }
+
+        bump = NULL;
+        bumpEnd = NULL;
+        freeList = NULL;
+        nextChunkSize = POOL_FIRST_CHUNK;
+        liveCount = 0;
+        reservedBytes = 0;
+    }
+
+    // Nodes currently allocated, and bytes held in chunks
+    int getLiveCount() const { return liveCount; }
+    size_t getReservedBytes() const { return reservedBytes; }
+};
+
+#endif // NODE_POOL_H
@@ -360,4 +360,26 @@ void Radar::printGridInfo()
     cout << Color::BOLD << Color::CYAN
          << "+----------------------------------+\n"
          << Color::RESET;
-}
\ No newline at end of file
+}
+
+// ========== SAVE BINARY SECTION ==========
+void Radar::saveBinary(BinaryWriter &out)
+{
+    out.writeI32(GRID_HEIGHT);
+    out.writeI32(GRID_WIDTH);
+    out.writeBytes(grid, sizeof(grid));
+}
+
+// ========== LOAD BINARY SECTION ==========
+bool Radar::loadBinary(BinaryReader &in)
+{
+    int rows = in.readI32();
+    int cols = in.readI32();
+
+    if (!in.ok() || rows != GRID_HEIGHT || cols != GRID_WIDTH)
+    {
+        return false;
+    }
+
+    return in.readBytes(grid, sizeof(grid));
+}
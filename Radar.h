@@ -3,6 +3,7 @@
 
 #include <string>
 #include <iostream>
+#include "BinaryIO.h"
 
 using namespace std;
 
@@ -83,6 +84,10 @@ public:
     int getWidth();
     int getHeight();
     void printGridInfo();
+
+    // Binary snapshot section (see Snapshot.h)
+    void saveBinary(BinaryWriter &out);
+    bool loadBinary(BinaryReader &in);
 };
 
 #endif // RADAR_H
\ No newline at end of file
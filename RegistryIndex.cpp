@@ -0,0 +1,167 @@
+#include "RegistryIndex.h"
+
+using namespace std;
+
+// ========== CONSTRUCTOR ==========
+AttributeIndex::AttributeIndex()
+{
+    head = NULL;
+    length = NULL;
+    keyCapacity = 0;
+
+    next = NULL;
+    prev = NULL;
+    capacity = 0;
+
+    reserveKeys(16);
+    reserve(64);
+}
+
+// ========== DESTRUCTOR ==========
+AttributeIndex::~AttributeIndex()
+{
+    delete[] head;
+    delete[] length;
+    delete[] next;
+    delete[] prev;
+}
+
+// ========== GROW PER-KEY ARRAYS ==========
+void AttributeIndex::reserveKeys(int keyCount)
+{
+    if (keyCount <= keyCapacity)
+    {
+        return;
+    }
+
+    int newCapacity = keyCapacity > 0 ? keyCapacity : 16;
+    while (newCapacity < keyCount)
+    {
+        newCapacity *= 2;
+    }
+
+    FlightHandle *newHead = new FlightHandle[newCapacity];
+    int *newLength = new int[newCapacity];
+    for (int i = 0; i < newCapacity; i++)
+    {
+        bool old = i < keyCapacity;
+        newHead[i] = old ? head[i] : NO_FLIGHT;
+        newLength[i] = old ? length[i] : 0;
+    }
+
+    delete[] head;
+    delete[] length;
+
+    head = newHead;
+    length = newLength;
+    keyCapacity = newCapacity;
+}
+
+// ========== GROW PER-FLIGHT ARRAYS ==========
+void AttributeIndex::reserve(int handleCount)
+{
+    if (handleCount <= capacity)
+    {
+        return;
+    }
+
+    int newCapacity = capacity > 0 ? capacity : 64;
+    while (newCapacity < handleCount)
+    {
+        newCapacity *= 2;
+    }
+
+    FlightHandle *newNext = new FlightHandle[newCapacity];
+    FlightHandle *newPrev = new FlightHandle[newCapacity];
+    for (int i = 0; i < newCapacity; i++)
+    {
+        bool old = i < capacity;
+        newNext[i] = old ? next[i] : NO_FLIGHT;
+        newPrev[i] = old ? prev[i] : NO_FLIGHT;
+    }
+
+    delete[] next;
+    delete[] prev;
+
+    next = newNext;
+    prev = newPrev;
+    capacity = newCapacity;
+}
+
+// ========== ADD ==========
+void AttributeIndex::add(FlightHandle flightID, int key)
+{
+    if (flightID == NO_FLIGHT || key < 0)
+    {
+        return;
+    }
+
+    reserve((int)flightID + 1);
+    reserveKeys(key + 1);
+
+    // Push at the head; query order is not significant
+    prev[flightID] = NO_FLIGHT;
+    next[flightID] = head[key];
+    if (head[key] != NO_FLIGHT)
+    {
+        prev[head[key]] = flightID;
+    }
+    head[key] = flightID;
+    length[key]++;
+}
+
+// ========== REMOVE ==========
+void AttributeIndex::remove(FlightHandle flightID, int key)
+{
+    if (flightID == NO_FLIGHT || (int)flightID >= capacity || key < 0 || key >= keyCapacity)
+    {
+        return;
+    }
+
+    if (prev[flightID] != NO_FLIGHT)
+        next[prev[flightID]] = next[flightID];
+    else
+        head[key] = next[flightID];
+
+    if (next[flightID] != NO_FLIGHT)
+        prev[next[flightID]] = prev[flightID];
+
+    next[flightID] = NO_FLIGHT;
+    prev[flightID] = NO_FLIGHT;
+    length[key]--;
+}
+
+// ========== CLEAR ==========
+void AttributeIndex::clear()
+{
+    for (int i = 0; i < keyCapacity; i++)
+    {
+        head[i] = NO_FLIGHT;
+        length[i] = 0;
+    }
+    for (int i = 0; i < capacity; i++)
+    {
+        next[i] = NO_FLIGHT;
+        prev[i] = NO_FLIGHT;
+    }
+}
+
+// ========== QUERIES ==========
+FlightHandle AttributeIndex::first(int key) const
+{
+    return (key >= 0 && key < keyCapacity) ? head[key] : NO_FLIGHT;
+}
+
+FlightHandle AttributeIndex::nextOf(FlightHandle flightID) const
+{
+    if (flightID == NO_FLIGHT || (int)flightID >= capacity)
+    {
+        return NO_FLIGHT;
+    }
+    return next[flightID];
+}
+
+int AttributeIndex::count(int key) const
+{
+    return (key >= 0 && key < keyCapacity) ? length[key] : 0;
+}
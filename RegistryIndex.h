@@ -0,0 +1,52 @@
+#ifndef REGISTRY_INDEX_H
+#define REGISTRY_INDEX_H
+
+#include "IDInterner.h"
+
+using namespace std;
+
+// ========== ATTRIBUTE INDEX CLASS ==========
+// One secondary index of the aircraft registry. Every key (a status or
+// a dictionary code) owns an intrusive list of the flights that have
+// it, linked through per-handle arrays like the holding queues. A flight
+// sits in at most one list and the caller passes its current key, so
+// add and remove are O(1) and a query walks only the matching flights.
+class AttributeIndex
+{
+private:
+    // Per key: first flight and list length
+    FlightHandle *head;
+    int *length;
+    int keyCapacity;
+
+    // Per handle: list links
+    FlightHandle *next;
+    FlightHandle *prev;
+    int capacity;
+
+    void reserveKeys(int keyCount);
+    void reserve(int handleCount);
+
+public:
+    // Constructor & Destructor
+    AttributeIndex();
+    ~AttributeIndex();
+
+    // Link a flight under a key (must not be linked already)
+    void add(FlightHandle flightID, int key);
+
+    // Unlink a flight from the key it was added under
+    void remove(FlightHandle flightID, int key);
+
+    // Drop every list
+    void clear();
+
+    // Flights with a key (NO_FLIGHT at the end)
+    FlightHandle first(int key) const;
+    FlightHandle nextOf(FlightHandle flightID) const;
+
+    // Flights with a key, O(1)
+    int count(int key) const;
+};
+
+#endif // REGISTRY_INDEX_H
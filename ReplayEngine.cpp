@@ -0,0 +1,159 @@
+#include "ReplayEngine.h"
+#include "Journal.h"
+#include <iostream>
+#include <chrono>
+
+using namespace std;
+
+// ========== COLOR CODES ==========
+const string RED = "\033[31m";
+const string GREEN = "\033[32m";
+const string YELLOW = "\033[33m";
+const string CYAN = "\033[36m";
+const string RESET = "\033[0m";
+const string BOLD = "\033[1m";
+
+// ========== STATE CHECKSUM ==========
+unsigned int computeStateChecksum(Graph &graph, FlightManager &flightMgr, HashTable &registry)
+{
+    unsigned int parts[3] = {graph.stateChecksum(), flightMgr.stateChecksum(),
+                             registry.stateChecksum()};
+    return checksumBytes((const char *)parts, sizeof(parts));
+}
+
+// ========== REPLAY ==========
+bool ReplayEngine::replay(const string &archiveFilename, ReplayResult &result)
+{
+    JournalReader reader;
+    if (!reader.open(archiveFilename))
+    {
+        return false;
+    }
+
+    // Fresh state, built the same way initializeAirspace() does
+    Graph *graph = new Graph();
+    FlightManager *flightMgr = new FlightManager();
+    HashTable *registry = new HashTable();
+    AirportLandingQueues *landingQueue = new AirportLandingQueues();
+    Journal applier;
+
+    unsigned long long firstStamp = 0;
+    unsigned long long lastStamp = 0;
+    JournalRecord record;
+
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    {
+        QuietConsole quiet;
+
+        graph->loadDefaultAirspace();
+        flightMgr->setGraphReference(graph);
+        flightMgr->setRegistryReference(registry);
+        flightMgr->setLandingQueueReference(landingQueue);
+        applier.setReferences(graph, flightMgr, registry, NULL);
+
+        while (reader.next(record))
+        {
+            BinaryReader payload(record.payload, record.length);
+
+            if (record.op == OP_EXTERNAL_STATE)
+            {
+                // Later events assume state this log never saw
+                result.stoppedAtExternal = true;
+                break;
+            }
+
+            if (record.op == OP_STATE_CHECKSUM)
+            {
+                unsigned int expected = payload.readU32();
+                unsigned long long stamp = payload.readU64();
+
+                if (firstStamp == 0)
+                {
+                    firstStamp = stamp;
+                }
+                lastStamp = stamp;
+
+                if (computeStateChecksum(*graph, *flightMgr, *registry) == expected)
+                {
+                    result.checksumsVerified++;
+                }
+                else
+                {
+                    if (result.checksumMismatches == 0)
+                    {
+                        result.firstMismatchLSN = record.lsn;
+                    }
+                    result.checksumMismatches++;
+                }
+                continue;
+            }
+
+            if (applier.applyRecord(record.op, payload))
+            {
+                result.events++;
+            }
+            else
+            {
+                result.failedEvents++;
+            }
+        }
+    }
+    result.replayMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    result.recordedMs = (double)(lastStamp - firstStamp);
+
+    delete flightMgr;
+    delete landingQueue;
+    delete registry;
+    delete graph;
+    return true;
+}
+
+// ========== RUN AND REPORT ==========
+void ReplayEngine::run(const string &archiveFilename)
+{
+    ReplayResult result;
+    if (!replay(archiveFilename, result))
+    {
+        cout << RED << "[ERROR]" << RESET << " No event log found in " << archiveFilename << endl;
+        return;
+    }
+
+    cout << CYAN << "\n[REPLAY REPORT]\n"
+         << RESET;
+    cout << "  Events Replayed:    " << result.events;
+    if (result.failedEvents > 0)
+    {
+        cout << " (" << YELLOW << result.failedEvents << " rejected" << RESET << ")";
+    }
+    cout << endl;
+    cout << "  Checksums Verified: " << result.checksumsVerified << endl;
+
+    if (result.checksumMismatches > 0)
+    {
+        cout << "  Checksum Mismatches: " << RED << result.checksumMismatches << RESET
+             << " (first at LSN " << result.firstMismatchLSN << ")" << endl;
+    }
+
+    cout << "  Replay Time:        " << result.replayMs << " ms" << endl;
+    if (result.recordedMs > 0 && result.replayMs > 0)
+    {
+        cout << "  Recorded Span:      " << result.recordedMs / 1000.0 << " s" << endl;
+        cout << "  Speedup:            " << BOLD << result.recordedMs / result.replayMs
+             << "x" << RESET << " faster than wall-clock" << endl;
+    }
+
+    if (result.stoppedAtExternal)
+    {
+        cout << YELLOW << "[WARNING]" << RESET
+             << " Replay stopped where system data was loaded from a snapshot" << endl;
+    }
+
+    if (result.checksumMismatches == 0)
+    {
+        cout << GREEN << "[SUCCESS]" << RESET << " Replay is deterministic" << endl;
+    }
+    else
+    {
+        cout << RED << "[ERROR]" << RESET << " Replayed state diverged from the recorded run" << endl;
+    }
+}
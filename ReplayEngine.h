@@ -0,0 +1,47 @@
+#ifndef REPLAY_ENGINE_H
+#define REPLAY_ENGINE_H
+
+#include <string>
+#include "Graph.h"
+#include "FlightManager.h"
+#include "HashTable.h"
+#include "AirportLandingQueues.h"
+
+using namespace std;
+
+// Checksum of the replayable state (graph, active flights, registry)
+unsigned int computeStateChecksum(Graph &graph, FlightManager &flightMgr, HashTable &registry);
+
+// ========== REPLAY RESULT ==========
+struct ReplayResult
+{
+    int events;              // records re-executed
+    int failedEvents;        // records whose operation was rejected
+    int checksumsVerified;   // checksum records that matched
+    int checksumMismatches;  // checksum records that did not
+    unsigned long long firstMismatchLSN;
+    bool stoppedAtExternal;  // log continues after a snapshot load
+    double replayMs;         // time spent replaying
+    double recordedMs;       // wall-clock span covered by the log
+
+    ReplayResult() : events(0), failedEvents(0), checksumsVerified(0),
+                     checksumMismatches(0), firstMismatchLSN(0),
+                     stoppedAtExternal(false), replayMs(0), recordedMs(0) {}
+};
+
+// ========== REPLAY ENGINE CLASS ==========
+// Re-executes the event archive written by the journal against a fresh
+// default airspace, an empty flight manager, registry and landing queue.
+// Console output is suppressed and every recorded state checksum is
+// compared with the replayed state to confirm the run is deterministic.
+class ReplayEngine
+{
+public:
+    // Replay a whole archive; false if the file cannot be read
+    bool replay(const string &archiveFilename, ReplayResult &result);
+
+    // Replay and print a report
+    void run(const string &archiveFilename);
+};
+
+#endif // REPLAY_ENGINE_H
@@ -0,0 +1,429 @@
+#include "RunwayScheduler.h"
+#include "Logger.h"
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+
+using namespace std;
+
+// ========== COLOR CODES ==========
+const string GREEN = "\033[32m";
+const string YELLOW = "\033[33m";
+const string CYAN = "\033[36m";
+const string RESET = "\033[0m";
+const string BOLD = "\033[1m";
+
+// Bookings listed per airport by displaySchedule
+const int DISPLAYED_BOOKINGS = 10;
+
+// ========== CONSTRUCTOR ==========
+RunwayScheduler::RunwayScheduler()
+{
+    timelineCount = 0;
+    bookedCount = 0;
+    capacity = 0;
+    slotOf = NULL;
+    leafOf = NULL;
+    timelineOf = NULL;
+
+    reserve(64);
+}
+
+// ========== DESTRUCTOR ==========
+RunwayScheduler::~RunwayScheduler()
+{
+    for (int i = 0; i < timelineCount; i++)
+    {
+        delete[] timelines[i].holder;
+        delete[] timelines[i].worst;
+    }
+
+    delete[] slotOf;
+    delete[] leafOf;
+    delete[] timelineOf;
+}
+
+// ========== GROW BOOKING ARRAYS ==========
+void RunwayScheduler::reserve(int handleCount)
+{
+    if (handleCount <= capacity)
+    {
+        return;
+    }
+
+    int newCapacity = capacity > 0 ? capacity : 64;
+    while (newCapacity < handleCount)
+    {
+        newCapacity *= 2;
+    }
+
+    int *newSlot = new int[newCapacity];
+    int *newLeaf = new int[newCapacity];
+    int *newTimeline = new int[newCapacity];
+
+    for (int i = 0; i < newCapacity; i++)
+    {
+        bool old = i < capacity;
+        newSlot[i] = old ? slotOf[i] : -1;
+        newLeaf[i] = old ? leafOf[i] : -1;
+        newTimeline[i] = old ? timelineOf[i] : -1;
+    }
+
+    delete[] slotOf;
+    delete[] leafOf;
+    delete[] timelineOf;
+    slotOf = newSlot;
+    leafOf = newLeaf;
+    timelineOf = newTimeline;
+    capacity = newCapacity;
+}
+
+// ========== FIND OR CREATE TIMELINE ==========
+int RunwayScheduler::findTimeline(int airportID, bool create)
+{
+    for (int i = 0; i < timelineCount; i++)
+    {
+        if (timelines[i].airportID == airportID)
+        {
+            return i;
+        }
+    }
+
+    if (!create || timelineCount >= MAX_NODES)
+    {
+        return -1;
+    }
+
+    RunwayTimeline &t = timelines[timelineCount];
+    t.airportID = airportID;
+    t.runways = DEFAULT_RUNWAYS;
+    t.leafCount = RUNWAY_HORIZON_SLOTS * DEFAULT_RUNWAYS;
+
+    t.treeSize = 1;
+    while (t.treeSize < t.leafCount)
+    {
+        t.treeSize *= 2;
+    }
+
+    t.holder = new FlightHandle[t.leafCount];
+    for (int i = 0; i < t.leafCount; i++)
+    {
+        t.holder[i] = NO_FLIGHT;
+    }
+
+    // Padding leaves stay 0 so they are never chosen
+    t.worst = new int[2 * t.treeSize];
+    for (int i = 0; i < 2 * t.treeSize; i++)
+    {
+        t.worst[i] = 0;
+    }
+    for (int i = 0; i < t.leafCount; i++)
+    {
+        t.worst[t.treeSize + i] = SLOT_FREE;
+    }
+    for (int i = t.treeSize - 1; i >= 1; i--)
+    {
+        t.worst[i] = max(t.worst[2 * i], t.worst[2 * i + 1]);
+    }
+
+    return timelineCount++;
+}
+
+// ========== SET LEAF ==========
+void RunwayScheduler::setLeaf(RunwayTimeline &t, int leaf, FlightHandle flightID, int value)
+{
+    t.holder[leaf] = flightID;
+
+    int node = t.treeSize + leaf;
+    t.worst[node] = value;
+    for (node /= 2; node >= 1; node /= 2)
+    {
+        t.worst[node] = max(t.worst[2 * node], t.worst[2 * node + 1]);
+    }
+}
+
+// ========== FIND FIRST LEAF ABOVE PRIORITY ==========
+int RunwayScheduler::findFirst(RunwayTimeline &t, int node, int nodeLo, int nodeHi,
+                               int lo, int hi, int above)
+{
+    // Skip subtrees outside the range or with nothing to take
+    if (nodeHi <= lo || hi <= nodeLo || t.worst[node] <= above)
+    {
+        return -1;
+    }
+
+    if (nodeHi - nodeLo == 1)
+    {
+        return nodeLo;
+    }
+
+    int mid = (nodeLo + nodeHi) / 2;
+    int leaf = findFirst(t, 2 * node, nodeLo, mid, lo, hi, above);
+    if (leaf != -1)
+    {
+        return leaf;
+    }
+    return findFirst(t, 2 * node + 1, mid, nodeHi, lo, hi, above);
+}
+
+// ========== FIND IN HORIZON (RING ORDER) ==========
+int RunwayScheduler::findInHorizon(RunwayTimeline &t, int baseLeaf, int offset, int above)
+{
+    if (offset >= t.leafCount)
+    {
+        return -1;
+    }
+
+    int start = (baseLeaf + offset) % t.leafCount;
+    int length = t.leafCount - offset;
+
+    if (start + length <= t.leafCount)
+    {
+        return findFirst(t, 1, 0, t.treeSize, start, start + length, above);
+    }
+
+    int leaf = findFirst(t, 1, 0, t.treeSize, start, t.leafCount, above);
+    if (leaf != -1)
+    {
+        return leaf;
+    }
+    return findFirst(t, 1, 0, t.treeSize, 0, start + length - t.leafCount, above);
+}
+
+// ========== PLACE BOOKING ==========
+void RunwayScheduler::place(FlightHandle flightID, int timeline, int leaf, int slot, int priority)
+{
+    reserve((int)flightID + 1);
+    if (timelineOf[flightID] == -1)
+    {
+        bookedCount++;
+    }
+
+    setLeaf(timelines[timeline], leaf, flightID, priority);
+    slotOf[flightID] = slot;
+    leafOf[flightID] = leaf;
+    timelineOf[flightID] = timeline;
+}
+
+// ========== BOOK SLOT ==========
+int RunwayScheduler::book(FlightHandle flightID, int airportID, int priority, int firstSlot)
+{
+    if (flightID == NO_FLIGHT || priority < 1 || priority >= SLOT_FREE || firstSlot < 0)
+    {
+        return -1;
+    }
+
+    cancel(flightID);
+
+    int ti = findTimeline(airportID, true);
+    if (ti == -1)
+    {
+        return -1;
+    }
+
+    RunwayTimeline &t = timelines[ti];
+    int baseLeaf = (firstSlot % RUNWAY_HORIZON_SLOTS) * t.runways;
+
+    // Earliest slot that is free or held by a less urgent flight
+    int leaf = findInHorizon(t, baseLeaf, 0, priority);
+    if (leaf == -1)
+    {
+        return -1;
+    }
+
+    int offset = (leaf - baseLeaf + t.leafCount) % t.leafCount;
+    int slot = firstSlot + offset / t.runways;
+
+    FlightHandle bumped = t.holder[leaf];
+    int bumpedPriority = t.worst[t.treeSize + leaf];
+
+    place(flightID, ti, leaf, slot, priority);
+
+    // A displaced flight takes the next slot after the one it lost that is
+    // free or held by a less urgent flight, displacing that holder in turn
+    while (bumped != NO_FLIGHT)
+    {
+        int nextLeaf = findInHorizon(t, baseLeaf, offset + 1, bumpedPriority);
+        if (nextLeaf == -1)
+        {
+            bookedCount--;
+            slotOf[bumped] = -1;
+            leafOf[bumped] = -1;
+            timelineOf[bumped] = -1;
+
+            LOG_WARNING << YELLOW << "[RUNWAY]" << RESET << " Flight " << CYAN << flightIDs().getName(bumped)
+                     << RESET << " lost its slot; no later slot within the horizon";
+            break;
+        }
+
+        offset = (nextLeaf - baseLeaf + t.leafCount) % t.leafCount;
+        FlightHandle moving = bumped;
+        int movingPriority = bumpedPriority;
+        bumped = t.holder[nextLeaf];
+        bumpedPriority = t.worst[t.treeSize + nextLeaf];
+
+        place(moving, ti, nextLeaf, firstSlot + offset / t.runways, movingPriority);
+
+        LOG_DEBUG << YELLOW << "[RUNWAY]" << RESET << " Flight " << CYAN << flightIDs().getName(moving)
+                  << RESET << " moved back to slot " << slotOf[moving];
+    }
+
+    return slot;
+}
+
+// ========== REBOOK AFTER PRIORITY CHANGE ==========
+int RunwayScheduler::rebook(FlightHandle flightID, int priority, int firstSlot)
+{
+    if (flightID == NO_FLIGHT || (int)flightID >= capacity || timelineOf[flightID] == -1)
+    {
+        return -1;
+    }
+
+    int airportID = timelines[timelineOf[flightID]].airportID;
+    return book(flightID, airportID, priority, firstSlot);
+}
+
+// ========== CANCEL BOOKING ==========
+void RunwayScheduler::cancel(FlightHandle flightID)
+{
+    if (flightID == NO_FLIGHT || (int)flightID >= capacity || timelineOf[flightID] == -1)
+    {
+        return;
+    }
+
+    setLeaf(timelines[timelineOf[flightID]], leafOf[flightID], NO_FLIGHT, SLOT_FREE);
+    bookedCount--;
+    slotOf[flightID] = -1;
+    leafOf[flightID] = -1;
+    timelineOf[flightID] = -1;
+}
+
+// ========== RESTORE BOOKING ==========
+bool RunwayScheduler::restore(FlightHandle flightID, int airportID, int slot, int runway, int priority)
+{
+    if (flightID == NO_FLIGHT || slot < 0 || priority < 1 || priority >= SLOT_FREE)
+    {
+        return false;
+    }
+
+    int ti = findTimeline(airportID, true);
+    if (ti == -1 || runway < 0 || runway >= timelines[ti].runways)
+    {
+        return false;
+    }
+
+    int leaf = (slot % RUNWAY_HORIZON_SLOTS) * timelines[ti].runways + runway;
+    if (timelines[ti].holder[leaf] != NO_FLIGHT)
+    {
+        return false;
+    }
+
+    place(flightID, ti, leaf, slot, priority);
+    return true;
+}
+
+// ========== CLEAR ==========
+void RunwayScheduler::clear()
+{
+    for (int h = 0; h < capacity; h++)
+    {
+        cancel(h);
+    }
+}
+
+// ========== BOOKING ACCESSORS ==========
+int RunwayScheduler::getSlot(FlightHandle flightID)
+{
+    if (flightID == NO_FLIGHT || (int)flightID >= capacity)
+    {
+        return -1;
+    }
+    return slotOf[flightID];
+}
+
+int RunwayScheduler::getRunway(FlightHandle flightID)
+{
+    if (flightID == NO_FLIGHT || (int)flightID >= capacity || leafOf[flightID] == -1)
+    {
+        return -1;
+    }
+    return leafOf[flightID] % timelines[timelineOf[flightID]].runways;
+}
+
+int RunwayScheduler::getBookedCount()
+{
+    return bookedCount;
+}
+
+// ========== COLLECT DUE FLIGHTS ==========
+int RunwayScheduler::collectDue(int slot, FlightHandle out[], int maxCount)
+{
+    int count = 0;
+
+    for (int i = 0; i < timelineCount; i++)
+    {
+        RunwayTimeline &t = timelines[i];
+        int baseLeaf = (slot % RUNWAY_HORIZON_SLOTS) * t.runways;
+
+        for (int r = 0; r < t.runways && count < maxCount; r++)
+        {
+            FlightHandle h = t.holder[baseLeaf + r];
+            if (h != NO_FLIGHT && slotOf[h] == slot)
+            {
+                out[count++] = h;
+            }
+        }
+    }
+
+    return count;
+}
+
+// ========== DISPLAY SCHEDULE ==========
+void RunwayScheduler::displaySchedule(Graph *graph, int firstSlot)
+{
+    logger().flush();
+
+    cout << BOLD << CYAN << "\n+=============================================================+\n";
+    cout << "|                 " << YELLOW << "RUNWAY SLOT SCHEDULE" << CYAN << "                        |\n";
+    cout << "+=============================================================+\n"
+         << RESET << endl;
+
+    bool any = false;
+    for (int i = 0; i < timelineCount; i++)
+    {
+        RunwayTimeline &t = timelines[i];
+        int baseLeaf = (firstSlot % RUNWAY_HORIZON_SLOTS) * t.runways;
+
+        int shown = 0;
+        for (int offset = 0; offset < t.leafCount && shown < DISPLAYED_BOOKINGS; offset++)
+        {
+            int leaf = (baseLeaf + offset) % t.leafCount;
+            FlightHandle h = t.holder[leaf];
+            if (h == NO_FLIGHT)
+            {
+                continue;
+            }
+
+            if (shown == 0)
+            {
+                Node *airport = graph != NULL ? graph->getNode(t.airportID) : NULL;
+                cout << BOLD << "  " << (airport != NULL ? airport->name : "Airport")
+                     << RESET << " (" << t.runways << " runways)" << endl;
+            }
+
+            cout << "    Tick " << setw(6) << slotOf[h] * RUNWAY_SEPARATION_TICKS
+                 << " | Runway " << leaf % t.runways + 1 << " | "
+                 << CYAN << setw(12) << flightIDs().getName(h) << RESET
+                 << " | Priority " << t.worst[t.treeSize + leaf] << endl;
+            shown++;
+            any = true;
+        }
+    }
+
+    if (!any)
+    {
+        cout << YELLOW << "  No landing slots booked\n"
+             << RESET;
+    }
+    cout << endl;
+}
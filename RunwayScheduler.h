@@ -0,0 +1,108 @@
+#ifndef RUNWAY_SCHEDULER_H
+#define RUNWAY_SCHEDULER_H
+
+#include "Graph.h"
+#include "IDInterner.h"
+
+using namespace std;
+
+// Runways at every airport
+const int DEFAULT_RUNWAYS = 2;
+
+// Minimum ticks between two landings on the same runway (one slot)
+const int RUNWAY_SEPARATION_TICKS = 2;
+
+// Slots that can be booked ahead on each runway
+const int RUNWAY_HORIZON_SLOTS = 4096;
+
+// Leaf value of a slot nobody holds (above every priority)
+const int SLOT_FREE = 5;
+
+// ========== RUNWAY TIMELINE ==========
+// Booked slots of one airport. Leaves are (slot, runway) pairs laid out
+// as a ring of RUNWAY_HORIZON_SLOTS slots; the segment tree keeps the
+// largest priority number (least urgent holder, or SLOT_FREE) below
+// each node so the earliest slot a flight may take is found in O(log n).
+struct RunwayTimeline
+{
+    int airportID;
+    int runways;
+    int leafCount;
+    int treeSize;         // leaves rounded up to a power of two
+    FlightHandle *holder; // flight holding each leaf
+    int *worst;           // segment tree over leaf priorities
+
+    RunwayTimeline() : airportID(-1), runways(0), leafCount(0), treeSize(0),
+                       holder(NULL), worst(NULL) {}
+};
+
+// ========== RUNWAY SCHEDULER CLASS ==========
+// Assigns landing slots per airport with runway separation. A flight
+// gets the earliest slot that is free or held by a less urgent flight;
+// a flight pushed out that way takes the next slot after the one it lost
+// by the same rule, so displacement cascades down the priorities.
+// Booking is O(k log n) for k flights moved; cancelling is O(log n).
+class RunwayScheduler
+{
+private:
+    RunwayTimeline timelines[MAX_NODES]; // created on first booking
+    int timelineCount;
+    int bookedCount;
+
+    // Per handle: booked slot (-1 = none), leaf and timeline
+    int *slotOf;
+    int *leafOf;
+    int *timelineOf;
+    int capacity;
+
+    // Grow booking arrays to cover handles below handleCount
+    void reserve(int handleCount);
+
+    // Timeline index for an airport (-1 if none and not created)
+    int findTimeline(int airportID, bool create);
+
+    void setLeaf(RunwayTimeline &t, int leaf, FlightHandle flightID, int value);
+
+    // First leaf in [lo, hi) whose value is above the given priority
+    int findFirst(RunwayTimeline &t, int node, int nodeLo, int nodeHi,
+                  int lo, int hi, int above);
+
+    // First leaf at or after offset in ring order from baseLeaf
+    int findInHorizon(RunwayTimeline &t, int baseLeaf, int offset, int above);
+
+    void place(FlightHandle flightID, int timeline, int leaf, int slot, int priority);
+
+public:
+    // Constructor & Destructor
+    RunwayScheduler();
+    ~RunwayScheduler();
+
+    // Book the earliest feasible slot at or after firstSlot; returns the
+    // slot, or -1 if every slot within the horizon is taken
+    int book(FlightHandle flightID, int airportID, int priority, int firstSlot);
+
+    // Book again after a priority change
+    int rebook(FlightHandle flightID, int priority, int firstSlot);
+
+    // Release a booking
+    void cancel(FlightHandle flightID);
+
+    // Put back a booking read from a snapshot
+    bool restore(FlightHandle flightID, int airportID, int slot, int runway, int priority);
+
+    // Drop every booking
+    void clear();
+
+    // Booking of one flight (-1 when not booked)
+    int getSlot(FlightHandle flightID);
+    int getRunway(FlightHandle flightID);
+    int getBookedCount();
+
+    // Flights booked for a slot at any airport; returns how many
+    int collectDue(int slot, FlightHandle out[], int maxCount);
+
+    // Print booked slots per airport from firstSlot on
+    void displaySchedule(Graph *graph, int firstSlot);
+};
+
+#endif // RUNWAY_SCHEDULER_H
@@ -0,0 +1,311 @@
+#include "ScheduleImporter.h"
+#include "Logger.h"
+#include <iostream>
+#include <cstdio>
+#include <cstring>
+#include <chrono>
+
+using namespace std;
+
+// ========== COLOR CODES ==========
+const string RED = "\033[31m";
+const string GREEN = "\033[32m";
+const string YELLOW = "\033[33m";
+const string CYAN = "\033[36m";
+const string RESET = "\033[0m";
+const string BOLD = "\033[1m";
+
+// Columns: flightID, origin, destination, priority, model
+const int IMPORT_FIELDS = 5;
+
+// ========== CONSTRUCTOR ==========
+ScheduleImporter::ScheduleImporter(Graph *graph, FlightManager *flightMgr)
+{
+    graphPtr = graph;
+    flightMgrPtr = flightMgr;
+    nameCount = 0;
+    lineNumber = 0;
+    seenRow = false;
+
+    for (int i = 0; i < MAX_NODES; i++)
+    {
+        for (int j = 0; j < MAX_NODES; j++)
+        {
+            routeLength[i][j] = -1;
+        }
+    }
+}
+
+// ========== RESOLVE NODE NAME ==========
+int ScheduleImporter::resolveName(const string &name)
+{
+    for (int i = 0; i < nameCount; i++)
+    {
+        if (names[i] == name)
+        {
+            return i;
+        }
+    }
+
+    // Unknown names are not cached; the row is rejected anyway
+    int id = graphPtr->getNodeID(name);
+    if (id == -1 || nameCount >= MAX_NODES)
+    {
+        return -1;
+    }
+
+    names[nameCount] = name;
+    nodeIDs[nameCount] = id;
+    return nameCount++;
+}
+
+// ========== PLAN ROUTE ==========
+int ScheduleImporter::planRoute(int fromSlot, int toSlot)
+{
+    if (routeLength[fromSlot][toSlot] == -1)
+    {
+        // One Dijkstra run per origin/destination pair
+        int length = 0;
+        graphPtr->getPath(nodeIDs[fromSlot], nodeIDs[toSlot], routes[fromSlot][toSlot], length);
+        routeLength[fromSlot][toSlot] = length;
+    }
+
+    return routeLength[fromSlot][toSlot];
+}
+
+// ========== RECORD ERROR ==========
+void ScheduleImporter::addError(ImportResult &result, const string &message)
+{
+    if (result.errorCount < MAX_REPORTED_ERRORS)
+    {
+        result.errors[result.errorCount].line = lineNumber;
+        result.errors[result.errorCount].message = message;
+    }
+    result.errorCount++;
+}
+
+// ========== IMPORT ONE ROW ==========
+bool ScheduleImporter::importRow(string fields[], string &message)
+{
+    const string &flightID = fields[0];
+    if (flightID.empty())
+    {
+        message = "missing flight ID";
+        return false;
+    }
+
+    if (flightMgrPtr->flightExists(flightID))
+    {
+        message = "flight " + flightID + " already exists";
+        return false;
+    }
+
+    int fromSlot = resolveName(fields[1]);
+    if (fromSlot == -1)
+    {
+        message = "unknown origin '" + fields[1] + "'";
+        return false;
+    }
+
+    int toSlot = resolveName(fields[2]);
+    if (toSlot == -1)
+    {
+        message = "unknown destination '" + fields[2] + "'";
+        return false;
+    }
+
+    const string &priorityText = fields[3];
+    if (priorityText.length() != 1 || priorityText[0] < '1' || priorityText[0] > '4')
+    {
+        message = "priority must be 1-4, got '" + priorityText + "'";
+        return false;
+    }
+
+    int length = planRoute(fromSlot, toSlot);
+    if (length == 0)
+    {
+        message = "no route from " + fields[1] + " to " + fields[2];
+        return false;
+    }
+
+    string model = fields[4].empty() ? "Aircraft" : fields[4];
+    if (!flightMgrPtr->addPlannedFlight(flightID, nodeIDs[fromSlot], nodeIDs[toSlot],
+                                        priorityText[0] - '0', model,
+                                        routes[fromSlot][toSlot], length))
+    {
+        message = "flight " + flightID + " rejected";
+        return false;
+    }
+
+    return true;
+}
+
+// ========== PROCESS ONE LINE ==========
+void ScheduleImporter::processLine(const char *line, size_t length, ImportResult &result)
+{
+    lineNumber++;
+
+    // Split on commas, trimming blanks (and a trailing '\r')
+    string fields[IMPORT_FIELDS];
+    int fieldCount = 0;
+    size_t start = 0;
+
+    while (start <= length)
+    {
+        const char *comma = (const char *)memchr(line + start, ',', length - start);
+        size_t end = (comma != NULL) ? (size_t)(comma - line) : length;
+
+        size_t first = start;
+        size_t last = end;
+        while (first < last && (line[first] == ' ' || line[first] == '\t'))
+            first++;
+        while (last > first && (line[last - 1] == ' ' || line[last - 1] == '\t' || line[last - 1] == '\r'))
+            last--;
+
+        if (fieldCount < IMPORT_FIELDS)
+        {
+            fields[fieldCount].assign(line + first, last - first);
+        }
+        fieldCount++;
+
+        if (comma == NULL)
+        {
+            break;
+        }
+        start = end + 1;
+    }
+
+    // Blank lines and comments
+    if ((fieldCount == 1 && fields[0].empty()) || (!fields[0].empty() && fields[0][0] == '#'))
+    {
+        return;
+    }
+
+    // Optional header row (its priority column is not a number)
+    if (!seenRow && fieldCount == IMPORT_FIELDS &&
+        (fields[3].empty() || fields[3][0] < '0' || fields[3][0] > '9'))
+    {
+        seenRow = true;
+        return;
+    }
+    seenRow = true;
+    result.rowsRead++;
+
+    if (fieldCount != IMPORT_FIELDS)
+    {
+        addError(result, "expected 5 columns, found " + to_string(fieldCount));
+        return;
+    }
+
+    string message;
+    if (importRow(fields, message))
+    {
+        result.imported++;
+    }
+    else
+    {
+        addError(result, message);
+    }
+}
+
+// ========== IMPORT FILE ==========
+bool ScheduleImporter::importFile(const string &filename, ImportResult &result)
+{
+    if (graphPtr == NULL || flightMgrPtr == NULL)
+    {
+        return false;
+    }
+
+    FILE *file = fopen(filename.c_str(), "rb");
+    if (file == NULL)
+    {
+        return false;
+    }
+
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+
+    // Row errors are collected in the result, not logged one by one
+    LogLevel savedLevel = logger().getLevel();
+    logger().flush();
+    logger().setLevel(LEVEL_QUIET);
+
+    lineNumber = 0;
+    seenRow = false;
+
+    char *chunk = new char[IMPORT_CHUNK_BYTES];
+    string carry; // incomplete last line of the previous chunk
+    size_t bytes;
+
+    while ((bytes = fread(chunk, 1, IMPORT_CHUNK_BYTES, file)) > 0)
+    {
+        size_t lineStart = 0;
+        const char *newline;
+
+        while ((newline = (const char *)memchr(chunk + lineStart, '\n', bytes - lineStart)) != NULL)
+        {
+            size_t lineEnd = (size_t)(newline - chunk);
+
+            if (carry.empty())
+            {
+                processLine(chunk + lineStart, lineEnd - lineStart, result);
+            }
+            else
+            {
+                carry.append(chunk + lineStart, lineEnd - lineStart);
+                processLine(carry.data(), carry.length(), result);
+                carry.clear();
+            }
+
+            lineStart = lineEnd + 1;
+        }
+
+        carry.append(chunk + lineStart, bytes - lineStart);
+    }
+
+    if (!carry.empty())
+    {
+        processLine(carry.data(), carry.length(), result);
+    }
+
+    delete[] chunk;
+    fclose(file);
+
+    logger().setLevel(savedLevel);
+    result.ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    return true;
+}
+
+// ========== RUN AND REPORT ==========
+void ScheduleImporter::run(const string &filename)
+{
+    ImportResult result;
+    if (!importFile(filename, result))
+    {
+        cout << RED << "[ERROR]" << RESET << " Could not open " << filename << endl;
+        return;
+    }
+
+    cout << CYAN << "\n[IMPORT REPORT]\n"
+         << RESET;
+    cout << "  Rows Read:      " << result.rowsRead << endl;
+    cout << "  Flights Added:  " << GREEN << result.imported << RESET << endl;
+    cout << "  Rows Rejected:  " << (result.errorCount > 0 ? RED : GREEN)
+         << result.errorCount << RESET << endl;
+    cout << "  Import Time:    " << result.ms << " ms";
+    if (result.ms > 0)
+    {
+        cout << " (" << (long)(result.rowsRead * 1000.0 / result.ms) << " rows/s)";
+    }
+    cout << endl;
+
+    int shown = result.errorCount < MAX_REPORTED_ERRORS ? (int)result.errorCount : MAX_REPORTED_ERRORS;
+    for (int i = 0; i < shown; i++)
+    {
+        cout << "  " << YELLOW << "Line " << result.errors[i].line << ":" << RESET
+             << " " << result.errors[i].message << endl;
+    }
+    if (result.errorCount > shown)
+    {
+        cout << "  ... and " << (result.errorCount - shown) << " more" << endl;
+    }
+}
@@ -0,0 +1,90 @@
+#ifndef SCHEDULE_IMPORTER_H
+#define SCHEDULE_IMPORTER_H
+
+#include <string>
+#include "Graph.h"
+#include "FlightManager.h"
+
+using namespace std;
+
+// File is read in chunks of this size
+const size_t IMPORT_CHUNK_BYTES = 1024 * 1024;
+
+// Only the first errors are kept for the report (all are counted)
+const int MAX_REPORTED_ERRORS = 20;
+
+// ========== IMPORT ERROR ==========
+struct ImportError
+{
+    long line;
+    string message;
+
+    ImportError() : line(0), message("") {}
+};
+
+// ========== IMPORT RESULT ==========
+struct ImportResult
+{
+    long rowsRead;
+    long imported;
+    long errorCount;
+    double ms;
+    ImportError errors[MAX_REPORTED_ERRORS];
+
+    ImportResult() : rowsRead(0), imported(0), errorCount(0), ms(0) {}
+};
+
+// ========== SCHEDULE IMPORTER CLASS ==========
+// Streams a CSV schedule into the flight manager (and through it the
+// registry). One row per flight:
+//
+//     flightID, origin, destination, priority, model
+//
+// Blank lines, lines starting with '#' and a header row are skipped.
+// Node names are resolved once and each origin/destination route is
+// planned with Dijkstra once; bad rows are reported and skipped.
+class ScheduleImporter
+{
+private:
+    Graph *graphPtr;
+    FlightManager *flightMgrPtr;
+
+    // Node names resolved so far and their node IDs
+    string names[MAX_NODES];
+    int nodeIDs[MAX_NODES];
+    int nameCount;
+
+    // Route cache indexed by name slot (-1 = not planned yet)
+    int routeLength[MAX_NODES][MAX_NODES];
+    int routes[MAX_NODES][MAX_NODES][MAX_NODES];
+
+    // Resolve a node name to its cache slot; -1 if not in the graph
+    int resolveName(const string &name);
+
+    // Plan (or reuse) the route between two slots; length 0 = no route
+    int planRoute(int fromSlot, int toSlot);
+
+    // Position in the file being imported
+    long lineNumber;
+    bool seenRow; // a header is only allowed before the first row
+
+    // Handle one line of the file
+    void processLine(const char *line, size_t length, ImportResult &result);
+
+    // Import one row; false with a message when rejected
+    bool importRow(string fields[], string &message);
+
+    void addError(ImportResult &result, const string &message);
+
+public:
+    // Constructor
+    ScheduleImporter(Graph *graph, FlightManager *flightMgr);
+
+    // Import a whole file; false if it cannot be opened
+    bool importFile(const string &filename, ImportResult &result);
+
+    // Import and print a report
+    void run(const string &filename);
+};
+
+#endif // SCHEDULE_IMPORTER_H
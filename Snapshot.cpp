@@ -0,0 +1,222 @@
+#include "Snapshot.h"
+#include "Journal.h"
+#include <iostream>
+#include <chrono>
+#include <cstdio>
+
+using namespace std;
+
+// ========== COLOR CODES ==========
+const string RED = "\033[31m";
+const string GREEN = "\033[32m";
+const string YELLOW = "\033[33m";
+const string CYAN = "\033[36m";
+const string RESET = "\033[0m";
+const string BOLD = "\033[1m";
+
+// Header: magic, version, payload size, payload checksum, checkpoint LSN
+const size_t SNAPSHOT_HEADER_SIZE = 24;
+
+// ========== CONSTRUCTOR ==========
+Snapshot::Snapshot(Graph *graph, Radar *radar, FlightManager *flightMgr,
+                   HashTable *registry, AirportLandingQueues *landingQueue, AVLTree *flightLog)
+{
+    graphPtr = graph;
+    radarPtr = radar;
+    flightMgrPtr = flightMgr;
+    registryPtr = registry;
+    landingQueuePtr = landingQueue;
+    flightLogPtr = flightLog;
+    loadedLSN = 0;
+}
+
+// ========== CHECK SECTION TAG ==========
+bool Snapshot::expectSection(BinaryReader &in, SnapshotSection section)
+{
+    return in.readU32() == (unsigned int)section && in.ok();
+}
+
+// ========== DECODE SECTIONS ==========
+bool Snapshot::decodeSections(BinaryReader &in, const HandleRemap &remap, Graph *graph, Radar *radar,
+                              FlightManager *flightMgr, HashTable *registry,
+                              AirportLandingQueues *landingQueue, AVLTree *flightLog)
+{
+    return expectSection(in, SECTION_GRAPH) && graph->loadBinary(in, remap) &&
+           expectSection(in, SECTION_RADAR) && radar->loadBinary(in) &&
+           expectSection(in, SECTION_FLIGHTS) && flightMgr->loadBinary(in, remap) &&
+           expectSection(in, SECTION_REGISTRY) && registry->loadBinary(in, remap) &&
+           expectSection(in, SECTION_LANDING_QUEUE) && landingQueue->loadBinary(in, remap) &&
+           expectSection(in, SECTION_FLIGHT_LOG) && flightLog->loadBinary(in, remap) &&
+           expectSection(in, SECTION_END);
+}
+
+// ========== SAVE SNAPSHOT ==========
+bool Snapshot::save(const string &filename, unsigned long long checkpointLSN)
+{
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+
+    BinaryWriter out;
+
+    // Header (size and checksum patched once the payload is known)
+    out.writeU32(SNAPSHOT_MAGIC);
+    out.writeU32(SNAPSHOT_VERSION);
+    out.writeU32(0);
+    out.writeU32(0);
+    out.writeU64(checkpointLSN);
+
+    out.writeU32(SECTION_IDS);
+    flightIDs().saveBinary(out);
+
+    out.writeU32(SECTION_GRAPH);
+    graphPtr->saveBinary(out);
+
+    out.writeU32(SECTION_RADAR);
+    radarPtr->saveBinary(out);
+
+    out.writeU32(SECTION_FLIGHTS);
+    flightMgrPtr->saveBinary(out);
+
+    out.writeU32(SECTION_REGISTRY);
+    registryPtr->saveBinary(out);
+
+    out.writeU32(SECTION_LANDING_QUEUE);
+    landingQueuePtr->saveBinary(out);
+
+    out.writeU32(SECTION_FLIGHT_LOG);
+    flightLogPtr->saveBinary(out);
+
+    out.writeU32(SECTION_END);
+
+    size_t payloadSize = out.getSize() - SNAPSHOT_HEADER_SIZE;
+    out.patchU32(8, (unsigned int)payloadSize);
+    out.patchU32(12, checksumBytes(out.getData() + SNAPSHOT_HEADER_SIZE, payloadSize));
+
+    // Write to a temporary file and rename, so a crash never leaves a half-written snapshot
+    string tempFile = filename + ".tmp";
+    bool written = writeWholeFile(tempFile, out.getData(), out.getSize());
+#ifdef _WIN32
+    remove(filename.c_str());
+#endif
+    if (!written || rename(tempFile.c_str(), filename.c_str()) != 0)
+    {
+        cout << RED << "[ERROR]" << RESET << " Could not write snapshot " << filename << endl;
+        return false;
+    }
+
+    double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    cout << GREEN << "[SUCCESS]" << RESET << " Snapshot saved to " << CYAN << filename
+         << RESET << " (" << out.getSize() << " bytes, " << ms << " ms)" << endl;
+    return true;
+}
+
+// ========== LOAD SNAPSHOT ==========
+bool Snapshot::load(const string &filename)
+{
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+
+    MappedFile file;
+    if (!file.open(filename))
+    {
+        cout << RED << "[ERROR]" << RESET << " Could not open snapshot " << filename << endl;
+        return false;
+    }
+
+    // Validate the header and payload before touching any live state
+    BinaryReader header(file.getData(), file.getSize());
+    unsigned int magic = header.readU32();
+    unsigned int version = header.readU32();
+    unsigned int payloadSize = header.readU32();
+    unsigned int checksum = header.readU32();
+    unsigned long long checkpointLSN = header.readU64();
+
+    if (!header.ok() || magic != SNAPSHOT_MAGIC)
+    {
+        cout << RED << "[ERROR]" << RESET << " " << filename << " is not a snapshot file" << endl;
+        return false;
+    }
+
+    if (version != SNAPSHOT_VERSION)
+    {
+        cout << RED << "[ERROR]" << RESET << " Unsupported snapshot version " << version << endl;
+        return false;
+    }
+
+    const char *payload = file.getData() + SNAPSHOT_HEADER_SIZE;
+    if (payloadSize != header.remaining() || checksumBytes(payload, payloadSize) != checksum)
+    {
+        cout << RED << "[ERROR]" << RESET << " Snapshot " << filename << " is corrupt" << endl;
+        return false;
+    }
+
+    BinaryReader in(payload, payloadSize);
+    HandleRemap remap;
+    if (!expectSection(in, SECTION_IDS) || !flightIDs().loadRemap(in, remap))
+    {
+        cout << RED << "[ERROR]" << RESET << " Snapshot " << filename
+             << " could not be restored - flight IDs are invalid" << endl;
+        return false;
+    }
+    size_t sectionsOffset = payloadSize - in.remaining();
+
+    // A section can still fail validation (duplicate handle, bad
+    // priority), so decode everything into staging objects first and
+    // leave the live state alone unless all of it loads
+    bool staged;
+    {
+        QuietConsole quiet;
+
+        Graph *stagedGraph = new Graph();
+        Radar *stagedRadar = new Radar();
+        FlightManager *stagedFlights = new FlightManager();
+        HashTable *stagedRegistry = new HashTable();
+        AirportLandingQueues *stagedQueue = new AirportLandingQueues();
+        AVLTree *stagedLog = new AVLTree();
+
+        stagedFlights->setGraphReference(stagedGraph);
+        stagedFlights->setRegistryReference(stagedRegistry);
+        stagedFlights->setLandingQueueReference(stagedQueue);
+        stagedQueue->setKind(landingQueuePtr->getKind());
+
+        staged = decodeSections(in, remap, stagedGraph, stagedRadar, stagedFlights,
+                                stagedRegistry, stagedQueue, stagedLog);
+
+        delete stagedFlights;
+        delete stagedQueue;
+        delete stagedRegistry;
+        delete stagedLog;
+        delete stagedRadar;
+        delete stagedGraph;
+    }
+
+    if (!staged)
+    {
+        cout << RED << "[ERROR]" << RESET << " Snapshot " << filename
+             << " could not be restored - current state kept" << endl;
+        return false;
+    }
+
+    // Every section is valid, so decoding the same bytes into the live
+    // objects (already wired to the journal, feed and each other) succeeds
+    BinaryReader live(payload + sectionsOffset, payloadSize - sectionsOffset);
+    if (!decodeSections(live, remap, graphPtr, radarPtr, flightMgrPtr, registryPtr,
+                        landingQueuePtr, flightLogPtr))
+    {
+        cout << RED << "[ERROR]" << RESET << " Snapshot " << filename
+             << " could not be fully restored" << endl;
+        return false;
+    }
+
+    loadedLSN = checkpointLSN;
+
+    double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    cout << GREEN << "[SUCCESS]" << RESET << " Snapshot restored from " << CYAN << filename
+         << RESET << " (" << flightMgrPtr->getTotalFlights() << " flights, "
+         << registryPtr->getTotalAircraft() << " aircraft, " << ms << " ms)" << endl;
+    return true;
+}
+
+// ========== GET CHECKPOINT LSN ==========
+unsigned long long Snapshot::getCheckpointLSN()
+{
+    return loadedLSN;
+}
@@ -0,0 +1,81 @@
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include <string>
+#include "Graph.h"
+#include "Radar.h"
+#include "FlightManager.h"
+#include "HashTable.h"
+#include "AirportLandingQueues.h"
+#include "AVLTree.h"
+#include "BinaryIO.h"
+
+using namespace std;
+
+const unsigned int SNAPSHOT_MAGIC = 0x53435441; // "ATCS" on disk
+const unsigned int SNAPSHOT_VERSION = 8;
+
+// Section tags, written in this order
+enum SnapshotSection
+{
+    SECTION_IDS = 1,
+    SECTION_GRAPH,
+    SECTION_RADAR,
+    SECTION_FLIGHTS,
+    SECTION_REGISTRY,
+    SECTION_LANDING_QUEUE,
+    SECTION_FLIGHT_LOG,
+    SECTION_END
+};
+
+// ========== SNAPSHOT CLASS ==========
+// Saves and restores the whole system (graph, radar, flights, registry,
+// landing queues and flight log) as one versioned binary file.
+//
+// Layout: header { magic, version, payload size, payload checksum,
+// checkpoint LSN }
+// followed by tagged sections. Flight IDs are written once in the IDs
+// section; every other section stores handles into that table.
+//
+// Loading is all or nothing: the sections are first decoded into
+// staging objects, and the live objects are only replaced once every
+// section has decoded and validated.
+class Snapshot
+{
+private:
+    Graph *graphPtr;
+    Radar *radarPtr;
+    FlightManager *flightMgrPtr;
+    HashTable *registryPtr;
+    AirportLandingQueues *landingQueuePtr;
+    AVLTree *flightLogPtr;
+
+    // Journal LSN covered by the last loaded snapshot
+    unsigned long long loadedLSN;
+
+    // Check a section tag
+    bool expectSection(BinaryReader &in, SnapshotSection section);
+
+    // Decode the sections after the IDs section into the given objects
+    bool decodeSections(BinaryReader &in, const HandleRemap &remap, Graph *graph, Radar *radar,
+                        FlightManager *flightMgr, HashTable *registry,
+                        AirportLandingQueues *landingQueue, AVLTree *flightLog);
+
+public:
+    // Constructor
+    Snapshot(Graph *graph, Radar *radar, FlightManager *flightMgr,
+             HashTable *registry, AirportLandingQueues *landingQueue, AVLTree *flightLog);
+
+    // Write every object to a single file; checkpointLSN is the last
+    // journal record the snapshot includes (0 when not checkpointing)
+    bool save(const string &filename, unsigned long long checkpointLSN = 0);
+
+    // Restore every object from a file written by save(); on failure
+    // the live objects are left as they were
+    bool load(const string &filename);
+
+    // Journal LSN stored in the last loaded snapshot
+    unsigned long long getCheckpointLSN();
+};
+
+#endif // SNAPSHOT_H
@@ -0,0 +1,183 @@
+// Landing requests from many approach-control threads into one landing
+// queue.
+//
+// Each producer thread submits the same number of (flight, priority)
+// requests for random flights. With the intake, producers push into the
+// lock-free LandingIntake and one sequencer thread drains it in batches
+// into a MinHeap (insert, or change priority if already queued). The
+// baseline has every producer lock one mutex and update the MinHeap
+// itself. Throughput is requests applied per second, start to finish.
+//
+// Build from the repository root:
+//   g++ -O2 -I. benchmarks/LandingIntakeBenchmark.cpp AirportLandingQueues.cpp AVLTree.cpp BinaryIO.cpp BucketQueue.cpp ChangeFeed.cpp ConcurrentRegistry.cpp ConflictForecaster.cpp FlightManager.cpp FuelWatch.cpp Graph.cpp HashTable.cpp HoldingQueues.cpp IDInterner.cpp Journal.cpp LandingIntake.cpp Logger.cpp MinHeap.cpp Radar.cpp RegistryIndex.cpp ReplayEngine.cpp RunwayScheduler.cpp ScheduleImporter.cpp Snapshot.cpp -pthread -o landing_intake_benchmark
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include "LandingIntake.h"
+#include "MinHeap.h"
+#include "Logger.h"
+
+using namespace std;
+
+const int BENCH_FLIGHTS = 50000;
+const int BENCH_REQUESTS_PER_THREAD = 200000;
+const int BENCH_MAX_THREADS = 8;
+
+FlightHandle *handles = NULL;
+
+// ========== APPLY ONE REQUEST ==========
+void applyRequest(MinHeap &queue, const LandingRequest &request)
+{
+    if (queue.contains(request.flightID))
+    {
+        queue.updatePriority(request.flightID, request.priority);
+    }
+    else
+    {
+        queue.insert(request.flightID, request.priority);
+    }
+}
+
+// Next random request of a producer
+LandingRequest nextRequest(unsigned int &state)
+{
+    state = state * 1664525u + 1013904223u;
+    LandingRequest request;
+    request.flightID = handles[(state >> 8) % BENCH_FLIGHTS];
+    request.priority = (int)(state >> 28) % LANDING_PRIORITIES + 1;
+    return request;
+}
+
+// ========== INTAKE ==========
+void intakeProducer(LandingIntake *intake, unsigned int seed)
+{
+    unsigned int state = seed;
+    for (int i = 0; i < BENCH_REQUESTS_PER_THREAD; i++)
+    {
+        LandingRequest request = nextRequest(state);
+
+        // Full ring: the sequencer is behind, give it the core
+        while (!intake->push(request.flightID, request.priority))
+        {
+            this_thread::yield();
+        }
+    }
+}
+
+double measureIntake(int threadCount, unsigned long long &rejected)
+{
+    LandingIntake *intake = new LandingIntake();
+    MinHeap queue;
+    thread producers[BENCH_MAX_THREADS];
+    LandingRequest batch[INTAKE_BATCH];
+    long total = (long)threadCount * BENCH_REQUESTS_PER_THREAD;
+
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    for (int t = 0; t < threadCount; t++)
+    {
+        producers[t] = thread(intakeProducer, intake, 12345u + t * 7919u);
+    }
+
+    // This thread is the sequencer
+    long applied = 0;
+    while (applied < total)
+    {
+        int count = intake->drain(batch, INTAKE_BATCH);
+        for (int i = 0; i < count; i++)
+        {
+            applyRequest(queue, batch[i]);
+        }
+        applied += count;
+
+        if (count == 0)
+        {
+            this_thread::yield();
+        }
+    }
+
+    for (int t = 0; t < threadCount; t++)
+    {
+        producers[t].join();
+    }
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    rejected = intake->getRejected();
+    delete intake;
+    return total / seconds;
+}
+
+// ========== MUTEX BASELINE ==========
+void lockedProducer(MinHeap *queue, mutex *lock, unsigned int seed)
+{
+    unsigned int state = seed;
+    for (int i = 0; i < BENCH_REQUESTS_PER_THREAD; i++)
+    {
+        LandingRequest request = nextRequest(state);
+
+        lock_guard<mutex> guard(*lock);
+        applyRequest(*queue, request);
+    }
+}
+
+double measureLocked(int threadCount)
+{
+    MinHeap queue;
+    mutex lock;
+    thread producers[BENCH_MAX_THREADS];
+    long total = (long)threadCount * BENCH_REQUESTS_PER_THREAD;
+
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    for (int t = 0; t < threadCount; t++)
+    {
+        producers[t] = thread(lockedProducer, &queue, &lock, 12345u + t * 7919u);
+    }
+    for (int t = 0; t < threadCount; t++)
+    {
+        producers[t].join();
+    }
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    return total / seconds;
+}
+
+// ========== MAIN ==========
+int main()
+{
+    logger().setLevel(LEVEL_WARNING);
+
+    handles = new FlightHandle[BENCH_FLIGHTS];
+    char buffer[32];
+    for (int i = 0; i < BENCH_FLIGHTS; i++)
+    {
+        sprintf(buffer, "LI%06d", i);
+        handles[i] = flightIDs().intern(buffer);
+    }
+
+    cout << "Landing request intake (" << BENCH_REQUESTS_PER_THREAD << " requests per producer, "
+         << BENCH_FLIGHTS << " flights, " << thread::hardware_concurrency() << " hardware threads)\n\n";
+    cout << "  Producers |   Intake req/s |    Mutex req/s | Speedup | Full-ring retries\n";
+    cout << "  ----------+----------------+----------------+---------+------------------\n";
+
+    for (int threads = 1; threads <= BENCH_MAX_THREADS; threads *= 2)
+    {
+        unsigned long long rejected = 0;
+        double intakeRate = measureIntake(threads, rejected);
+        double lockedRate = measureLocked(threads);
+
+        cout << "  " << setw(9) << threads << " | " << setw(14) << (long)intakeRate
+             << " | " << setw(14) << (long)lockedRate << " | "
+             << fixed << setprecision(2) << setw(6) << intakeRate / lockedRate << "x | "
+             << setw(16) << rejected << "\n";
+        cout.unsetf(ios::fixed);
+    }
+
+    delete[] handles;
+    logger().flush();
+    return 0;
+}
@@ -0,0 +1,178 @@
+// Landing queue cost: binary heap (MinHeap) against priority buckets
+// (BucketQueue).
+//
+// Both queues are driven through the LandingQueue interface with the
+// same flights and the same operation mix: insert every flight (64 per
+// ETA tick), change the priority of every flight (emergency overrides),
+// remove every fourth flight (diversions), save the queue and load it
+// back (the snapshot path, bulk-built for the heap), then land the rest
+// with extractMin. Each landing order is checked against the shared
+// rule (priority, then ETA, then arrival, a priority change keeping the
+// flight's place), and the two queues must land flights in exactly the
+// same order.
+//
+// Build from the repository root:
+//   g++ -O2 -I. benchmarks/LandingQueueBenchmark.cpp AirportLandingQueues.cpp AVLTree.cpp BinaryIO.cpp BucketQueue.cpp ChangeFeed.cpp ConcurrentRegistry.cpp ConflictForecaster.cpp FlightManager.cpp FuelWatch.cpp Graph.cpp HashTable.cpp HoldingQueues.cpp IDInterner.cpp Journal.cpp LandingIntake.cpp Logger.cpp MinHeap.cpp Radar.cpp RegistryIndex.cpp ReplayEngine.cpp RunwayScheduler.cpp ScheduleImporter.cpp Snapshot.cpp -pthread -o landing_queue_benchmark
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <chrono>
+#include <cstdio>
+#include "MinHeap.h"
+#include "BucketQueue.h"
+#include "Logger.h"
+
+using namespace std;
+
+const int BENCH_FLIGHTS = 200000;
+const int BENCH_ROUNDS = 5;
+const int BENCH_FLIGHTS_PER_TICK = 64;
+
+FlightHandle *handles = NULL;
+HandleRemap identity;
+int *firstPriority = NULL;
+int *secondPriority = NULL;
+
+// ========== TIMING ==========
+double millisecondsSince(chrono::steady_clock::time_point start)
+{
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+// ========== ONE QUEUE ==========
+// Fills landed with the landing order of the last round; returns its length
+int benchmarkQueue(const string &name, LandingQueue *queue, FlightHandle landed[])
+{
+    double insertMs = 0, updateMs = 0, removeMs = 0, loadMs = 0, extractMs = 0;
+    bool ordered = true;
+    int landedCount = 0;
+
+    for (int round = 0; round < BENCH_ROUNDS; round++)
+    {
+        chrono::steady_clock::time_point start = chrono::steady_clock::now();
+        for (int i = 0; i < BENCH_FLIGHTS; i++)
+        {
+            queue->insert(handles[i], firstPriority[i], i / BENCH_FLIGHTS_PER_TICK);
+        }
+        insertMs += millisecondsSince(start);
+
+        start = chrono::steady_clock::now();
+        for (int i = 0; i < BENCH_FLIGHTS; i++)
+        {
+            queue->updatePriority(handles[i], secondPriority[i]);
+        }
+        updateMs += millisecondsSince(start);
+
+        start = chrono::steady_clock::now();
+        for (int i = 0; i < BENCH_FLIGHTS; i += 4)
+        {
+            queue->remove(handles[i]);
+        }
+        removeMs += millisecondsSince(start);
+
+        BinaryWriter section;
+        queue->saveBinary(section);
+        BinaryReader in(section.getData(), section.getSize());
+        start = chrono::steady_clock::now();
+        if (!queue->loadBinary(in, identity))
+        {
+            ordered = false;
+        }
+        loadMs += millisecondsSince(start);
+
+        // Flight i arrived i-th, so (priority, ETA, i) must never go down
+        int lastPriority = 0;
+        int lastETA = 0;
+        int lastArrival = -1;
+        landedCount = 0;
+        start = chrono::steady_clock::now();
+        while (!queue->isEmpty())
+        {
+            Flight flight = queue->extractMin();
+            int i = flight.flightID - handles[0];
+            if (flight.priority < lastPriority ||
+                (flight.priority == lastPriority &&
+                 (flight.eta < lastETA || (flight.eta == lastETA && i < lastArrival))))
+            {
+                ordered = false;
+            }
+            lastPriority = flight.priority;
+            lastETA = flight.eta;
+            lastArrival = i;
+            landed[landedCount++] = flight.flightID;
+        }
+        extractMs += millisecondsSince(start);
+    }
+
+    cout << "  " << left << setw(12) << name << right << fixed << setprecision(2)
+         << " | insert " << setw(7) << insertMs / BENCH_ROUNDS << " ms"
+         << " | update " << setw(7) << updateMs / BENCH_ROUNDS << " ms"
+         << " | remove " << setw(6) << removeMs / BENCH_ROUNDS << " ms"
+         << " | load " << setw(6) << loadMs / BENCH_ROUNDS << " ms"
+         << " | extract " << setw(7) << extractMs / BENCH_ROUNDS << " ms"
+         << " | " << (ordered ? "in order" : "OUT OF ORDER") << "\n";
+    cout.unsetf(ios::fixed);
+    return landedCount;
+}
+
+// ========== MAIN ==========
+int main()
+{
+    logger().setLevel(LEVEL_WARNING);
+
+    handles = new FlightHandle[BENCH_FLIGHTS];
+    firstPriority = new int[BENCH_FLIGHTS];
+    secondPriority = new int[BENCH_FLIGHTS];
+
+    // Mostly normal traffic with some low-fuel, low and critical flights
+    const int mix[16] = {3, 3, 3, 3, 3, 3, 3, 3, 3, 2, 2, 2, 4, 4, 4, 1};
+    char buffer[32];
+    unsigned int seed = 12345;
+    for (int i = 0; i < BENCH_FLIGHTS; i++)
+    {
+        sprintf(buffer, "LQ%06d", i);
+        handles[i] = flightIDs().intern(buffer);
+
+        seed = seed * 1103515245 + 12345;
+        firstPriority[i] = mix[(seed >> 16) % 16];
+        seed = seed * 1103515245 + 12345;
+        secondPriority[i] = mix[(seed >> 16) % 16];
+    }
+
+    identity.resize(flightIDs().getCount());
+    for (int h = 1; h <= flightIDs().getCount(); h++)
+    {
+        identity.set(h, h);
+    }
+
+    cout << "Landing queue, " << BENCH_FLIGHTS << " flights, average of "
+         << BENCH_ROUNDS << " rounds\n\n";
+
+    FlightHandle *heapOrder = new FlightHandle[BENCH_FLIGHTS];
+    FlightHandle *bucketOrder = new FlightHandle[BENCH_FLIGHTS];
+
+    LandingQueue *heap = new MinHeap();
+    int heapLanded = benchmarkQueue("MinHeap", heap, heapOrder);
+    delete heap;
+
+    LandingQueue *buckets = new BucketQueue();
+    int bucketLanded = benchmarkQueue("BucketQueue", buckets, bucketOrder);
+    delete buckets;
+
+    bool same = heapLanded == bucketLanded;
+    for (int i = 0; same && i < heapLanded; i++)
+    {
+        same = heapOrder[i] == bucketOrder[i];
+    }
+    cout << "\n  Landing order: " << (same ? "identical" : "DIFFERENT") << " for both queues\n";
+
+    delete[] heapOrder;
+    delete[] bucketOrder;
+
+    delete[] handles;
+    delete[] firstPriority;
+    delete[] secondPriority;
+    logger().flush();
+    return 0;
+}
@@ -0,0 +1,208 @@
+// Node allocation cost in the registry, airspace graph and flight log.
+//
+// Part 1 builds and tears down the real structures (HashTable records,
+// Graph edges, AVLTree logs) and times both phases. Part 2 allocates the
+// same node types one by one with new/delete and with NodePool, so the
+// allocator difference is visible without the structure's own work. It
+// also runs the flight log node as it was before its strings were
+// encoded (AVLNode with strings), which the pool had to destroy one by
+// one; the encoded AVLNode is released in one pass.
+//
+// Build from the repository root:
+//   g++ -O2 -I. benchmarks/NodePoolBenchmark.cpp AirportLandingQueues.cpp AVLTree.cpp BinaryIO.cpp BucketQueue.cpp ChangeFeed.cpp ConcurrentRegistry.cpp ConflictForecaster.cpp FlightManager.cpp FuelWatch.cpp Graph.cpp HashTable.cpp HoldingQueues.cpp IDInterner.cpp Journal.cpp LandingIntake.cpp Logger.cpp MinHeap.cpp Radar.cpp RegistryIndex.cpp ReplayEngine.cpp RunwayScheduler.cpp ScheduleImporter.cpp Snapshot.cpp -pthread -o node_pool_benchmark
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <chrono>
+#include <cstdio>
+#include <type_traits>
+#include "HashTable.h"
+#include "Graph.h"
+#include "AVLTree.h"
+#include "NodePool.h"
+#include "Logger.h"
+
+using namespace std;
+
+const int BENCH_AIRCRAFT = 200000;
+const int BENCH_EDGES = 200000;
+const int BENCH_LOGS = 100000;
+const int BENCH_NODES = 1000000;
+
+string *flightNames = NULL;
+
+// ========== TIMING ==========
+double millisecondsSince(chrono::steady_clock::time_point start)
+{
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+void report(const string &name, int count, double buildMs, double teardownMs)
+{
+    cout << "  " << left << setw(22) << name << right
+         << " | " << setw(10) << (long)(count / (buildMs / 1000.0)) << " inserts/s"
+         << " | build " << setw(8) << fixed << setprecision(2) << buildMs << " ms"
+         << " | teardown " << setw(7) << teardownMs << " ms\n";
+    cout.unsetf(ios::fixed);
+}
+
+// ========== PART 1: STRUCTURES ==========
+void benchmarkRegistry()
+{
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    HashTable *table = new HashTable();
+    for (int i = 0; i < BENCH_AIRCRAFT; i++)
+    {
+        table->insertAircraft(flightNames[i], "A320", 50, "JFK", "LHR", "FLYING");
+    }
+    double buildMs = millisecondsSince(start);
+
+    start = chrono::steady_clock::now();
+    delete table;
+    report("HashTable records", BENCH_AIRCRAFT, buildMs, millisecondsSince(start));
+}
+
+void benchmarkGraph()
+{
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    Graph *graph = new Graph();
+    for (int i = 0; i < MAX_NODES; i++)
+    {
+        graph->addNode(i, "N" + to_string(i), i, i, WAYPOINT);
+    }
+    for (int i = 0; i < BENCH_EDGES; i++)
+    {
+        graph->addEdge(i % MAX_NODES, (i * 7 + 3) % MAX_NODES, 10 + i % 90);
+    }
+    double buildMs = millisecondsSince(start);
+
+    start = chrono::steady_clock::now();
+    delete graph;
+    report("Graph edges", BENCH_EDGES, buildMs, millisecondsSince(start));
+}
+
+void benchmarkFlightLog()
+{
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    AVLTree *tree = new AVLTree();
+    for (int i = 0; i < BENCH_LOGS; i++)
+    {
+        // Logs are ordered by arrival time, so every log needs its own
+        tree->insertLog(flightNames[i], "JFK", "LHR", flightNames[(i * 7919) % BENCH_LOGS], "LANDED");
+    }
+    double buildMs = millisecondsSince(start);
+
+    start = chrono::steady_clock::now();
+    delete tree;
+    report("AVLTree logs", BENCH_LOGS, buildMs, millisecondsSince(start));
+}
+
+// ========== PART 2: ALLOCATORS ==========
+// The flight log node before its strings were encoded
+struct StringFlightLog
+{
+    FlightHandle flightID;
+    string origin;
+    string destination;
+    string arrivalTime;
+    string result;
+};
+
+struct StringAVLNode
+{
+    StringFlightLog logData;
+    StringAVLNode *left;
+    StringAVLNode *right;
+    int height;
+
+    StringAVLNode(const StringFlightLog &log) : logData(log), left(NULL), right(NULL), height(1) {}
+};
+
+// Nodes are allocated one at a time, then all released the way the
+// structures do it: nodes with nothing to destruct by releaseAll alone,
+// the rest (StringAVLNode holds strings) destroyed first
+template <class T, class A>
+void benchmarkAllocator(const string &name, const A &value)
+{
+    T **nodes = new T *[BENCH_NODES];
+
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    for (int i = 0; i < BENCH_NODES; i++)
+    {
+        nodes[i] = new T(value);
+    }
+    double newMs = millisecondsSince(start);
+
+    start = chrono::steady_clock::now();
+    for (int i = 0; i < BENCH_NODES; i++)
+    {
+        delete nodes[i];
+    }
+    double deleteMs = millisecondsSince(start);
+
+    NodePool<T> *pool = new NodePool<T>();
+    start = chrono::steady_clock::now();
+    for (int i = 0; i < BENCH_NODES; i++)
+    {
+        nodes[i] = pool->create(value);
+    }
+    double poolMs = millisecondsSince(start);
+
+    start = chrono::steady_clock::now();
+    if (!is_trivially_destructible<T>::value)
+    {
+        for (int i = 0; i < BENCH_NODES; i++)
+        {
+            pool->destroy(nodes[i]);
+        }
+    }
+    pool->releaseAll();
+    double releaseMs = millisecondsSince(start);
+    delete pool;
+
+    cout << "  " << left << setw(17) << name << right << fixed << setprecision(2)
+         << " | new " << setw(7) << newMs << " ms | pool " << setw(7) << poolMs << " ms"
+         << " | delete " << setw(7) << deleteMs << " ms | release " << setw(6) << releaseMs << " ms\n";
+    cout.unsetf(ios::fixed);
+
+    delete[] nodes;
+}
+
+// ========== MAIN ==========
+int main()
+{
+    logger().setLevel(LEVEL_WARNING);
+
+    flightNames = new string[BENCH_AIRCRAFT];
+    char buffer[32];
+    for (int i = 0; i < BENCH_AIRCRAFT; i++)
+    {
+        sprintf(buffer, "NP%06d", i);
+        flightNames[i] = buffer;
+    }
+
+    cout << "Structures (build, then delete the whole structure)\n\n";
+    benchmarkRegistry();
+    benchmarkGraph();
+    benchmarkFlightLog();
+
+    cout << "\nAllocators (" << BENCH_NODES << " nodes each)\n\n";
+    Aircraft aircraft;
+    benchmarkAllocator<HashNode>("HashNode", aircraft);
+    benchmarkAllocator<EdgeNode>("EdgeNode", Edge(1, 50));
+
+    // Flight log node before and after encoding its strings
+    StringFlightLog stringLog;
+    stringLog.flightID = 1;
+    stringLog.origin = "JFK";
+    stringLog.destination = "LHR";
+    stringLog.arrivalTime = "2024-01-01 12:00:00";
+    stringLog.result = "LANDED";
+    benchmarkAllocator<StringAVLNode>("AVLNode (strings)", stringLog);
+    benchmarkAllocator<AVLNode>("AVLNode", FlightLog(1, "JFK", "LHR", "2024-01-01 12:00:00", "LANDED"));
+
+    delete[] flightNames;
+    logger().flush();
+    return 0;
+}
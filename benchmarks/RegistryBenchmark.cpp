@@ -0,0 +1,165 @@
+// Multi-threaded throughput of the aircraft registry.
+//
+// Every thread runs the same mix of searchAircraft (80%), updateFuel
+// (10%) and updateStatus (10%) on random registered flights, first on
+// ConcurrentRegistry and then on a single HashTable behind one mutex
+// for comparison.
+//
+// Build from the repository root:
+//   g++ -O2 -I. benchmarks/RegistryBenchmark.cpp AirportLandingQueues.cpp AVLTree.cpp BinaryIO.cpp BucketQueue.cpp ChangeFeed.cpp ConcurrentRegistry.cpp ConflictForecaster.cpp FlightManager.cpp FuelWatch.cpp Graph.cpp HashTable.cpp HoldingQueues.cpp IDInterner.cpp Journal.cpp LandingIntake.cpp Logger.cpp MinHeap.cpp Radar.cpp RegistryIndex.cpp ReplayEngine.cpp RunwayScheduler.cpp ScheduleImporter.cpp Snapshot.cpp -pthread -o registry_benchmark
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <thread>
+#include <mutex>
+#include <chrono>
+#include <cstdio>
+#include "ConcurrentRegistry.h"
+#include "HashTable.h"
+#include "Logger.h"
+
+using namespace std;
+
+const int BENCH_AIRCRAFT = 100000;
+const int BENCH_OPS_PER_THREAD = 400000;
+const int BENCH_MAX_THREADS = 8;
+
+string *flightNames = NULL;
+
+const string STATUSES[4] = {"FLYING", "APPROACHING", "HOLDING", "LANDED"};
+
+// ========== MUTEX BASELINE ==========
+// The plain registry made thread-safe the simple way
+class LockedRegistry
+{
+private:
+    mutex lock;
+    HashTable table;
+
+public:
+    void insertAircraft(const string &flightID, int fuel)
+    {
+        lock_guard<mutex> guard(lock);
+        table.insertAircraft(flightID, "A320", fuel, "JFK", "LHR", "FLYING");
+    }
+
+    bool searchAircraft(const string &flightID, Aircraft &out)
+    {
+        lock_guard<mutex> guard(lock);
+        Aircraft *a = table.searchAircraft(flightID);
+        if (a != NULL)
+        {
+            out = *a;
+        }
+        return a != NULL;
+    }
+
+    void updateFuel(const string &flightID, int fuel)
+    {
+        lock_guard<mutex> guard(lock);
+        table.updateFuel(flightID, fuel);
+    }
+
+    void updateStatus(const string &flightID, const string &status)
+    {
+        lock_guard<mutex> guard(lock);
+        table.updateStatus(flightID, status);
+    }
+};
+
+// ========== WORKLOAD ==========
+template <class Registry>
+void runWorker(Registry *registry, unsigned int seed, long *found)
+{
+    unsigned int state = seed;
+    Aircraft copy;
+    long hits = 0;
+
+    for (int i = 0; i < BENCH_OPS_PER_THREAD; i++)
+    {
+        state = state * 1664525u + 1013904223u;
+        const string &id = flightNames[(state >> 8) % BENCH_AIRCRAFT];
+        int op = state % 10;
+
+        if (op < 8)
+        {
+            hits += registry->searchAircraft(id, copy) ? 1 : 0;
+        }
+        else if (op == 8)
+        {
+            registry->updateFuel(id, 10 + (int)(state % 91));
+        }
+        else
+        {
+            registry->updateStatus(id, STATUSES[state % 4]);
+        }
+    }
+
+    *found = hits;
+}
+
+template <class Registry>
+double measure(Registry *registry, int threadCount)
+{
+    thread workers[BENCH_MAX_THREADS];
+    long found[BENCH_MAX_THREADS];
+
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    for (int t = 0; t < threadCount; t++)
+    {
+        workers[t] = thread(runWorker<Registry>, registry, 12345u + t * 7919u, &found[t]);
+    }
+    for (int t = 0; t < threadCount; t++)
+    {
+        workers[t].join();
+    }
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    return (double)threadCount * BENCH_OPS_PER_THREAD / seconds;
+}
+
+// ========== MAIN ==========
+int main()
+{
+    // Disabled levels cost one comparison, so per-operation messages are free
+    logger().setLevel(LEVEL_WARNING);
+
+    flightNames = new string[BENCH_AIRCRAFT];
+    char buffer[32];
+    for (int i = 0; i < BENCH_AIRCRAFT; i++)
+    {
+        sprintf(buffer, "BN%06d", i);
+        flightNames[i] = buffer;
+    }
+
+    ConcurrentRegistry *sharded = new ConcurrentRegistry();
+    LockedRegistry *locked = new LockedRegistry();
+    for (int i = 0; i < BENCH_AIRCRAFT; i++)
+    {
+        sharded->insertAircraft(flightNames[i], "A320", 50, "JFK", "LHR", "FLYING");
+        locked->insertAircraft(flightNames[i], 50);
+    }
+
+    cout << "Registry throughput (" << BENCH_AIRCRAFT << " aircraft, 80% search / 10% fuel / 10% status, "
+         << thread::hardware_concurrency() << " hardware threads)\n\n";
+    cout << "  Threads |   Sharded ops/s |    Mutex ops/s | Speedup\n";
+    cout << "  --------+-----------------+----------------+--------\n";
+
+    for (int threads = 1; threads <= BENCH_MAX_THREADS; threads *= 2)
+    {
+        double shardedRate = measure(sharded, threads);
+        double lockedRate = measure(locked, threads);
+
+        cout << "  " << setw(7) << threads << " | " << setw(15) << (long)shardedRate
+             << " | " << setw(14) << (long)lockedRate << " | "
+             << fixed << setprecision(2) << setw(6) << shardedRate / lockedRate << "x\n";
+        cout.unsetf(ios::fixed);
+    }
+
+    delete sharded;
+    delete locked;
+    delete[] flightNames;
+    logger().flush();
+    return 0;
+}
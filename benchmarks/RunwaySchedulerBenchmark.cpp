@@ -0,0 +1,163 @@
+// Runway slot booking cost and order.
+//
+// First a fixed case: slot 0 held by A and B (priority 3), slot 1 by C
+// and D (priority 4), then E (priority 1) books slot 0. A is displaced
+// and must take C's place in slot 1 rather than fall behind C and D;
+// C then moves on to slot 2. Then every flight of a random priority mix
+// books the same airport from slot 0, and the resulting schedule must
+// run in priority order however many flights each booking displaced.
+//
+// Build from the repository root:
+//   g++ -O2 -I. benchmarks/RunwaySchedulerBenchmark.cpp AirportLandingQueues.cpp AVLTree.cpp BinaryIO.cpp BucketQueue.cpp ChangeFeed.cpp ConcurrentRegistry.cpp ConflictForecaster.cpp FlightManager.cpp FuelWatch.cpp Graph.cpp HashTable.cpp HoldingQueues.cpp IDInterner.cpp Journal.cpp LandingIntake.cpp Logger.cpp MinHeap.cpp Radar.cpp RegistryIndex.cpp ReplayEngine.cpp RunwayScheduler.cpp ScheduleImporter.cpp Snapshot.cpp -pthread -o runway_scheduler_benchmark
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <chrono>
+#include <cstdio>
+#include "RunwayScheduler.h"
+#include "Logger.h"
+
+using namespace std;
+
+// Fills the horizon of one airport (2 runways x 4096 slots)
+const int BENCH_FLIGHTS = RUNWAY_HORIZON_SLOTS * DEFAULT_RUNWAYS;
+const int BENCH_ROUNDS = 5;
+const int BENCH_AIRPORT = 0;
+
+// ========== TIMING ==========
+double millisecondsSince(chrono::steady_clock::time_point start)
+{
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+// ========== FIXED CASE ==========
+bool checkCascade()
+{
+    RunwayScheduler scheduler;
+    FlightHandle a = flightIDs().intern("RWY-A");
+    FlightHandle b = flightIDs().intern("RWY-B");
+    FlightHandle c = flightIDs().intern("RWY-C");
+    FlightHandle d = flightIDs().intern("RWY-D");
+    FlightHandle e = flightIDs().intern("RWY-E");
+
+    scheduler.book(a, BENCH_AIRPORT, 3, 0);
+    scheduler.book(b, BENCH_AIRPORT, 3, 0);
+    scheduler.book(c, BENCH_AIRPORT, 4, 1);
+    scheduler.book(d, BENCH_AIRPORT, 4, 1);
+    scheduler.book(e, BENCH_AIRPORT, 1, 0);
+
+    FlightHandle flights[5] = {a, b, c, d, e};
+    const char *names[5] = {"A", "B", "C", "D", "E"};
+    int expected[5] = {1, 0, 2, 1, 0};
+    bool ok = true;
+
+    cout << "  Slots after E books slot 0:";
+    for (int i = 0; i < 5; i++)
+    {
+        int slot = scheduler.getSlot(flights[i]);
+        cout << " " << names[i] << "=" << slot;
+        ok = ok && slot == expected[i];
+    }
+    cout << " | " << (ok ? "as expected" : "WRONG") << "\n";
+    return ok;
+}
+
+// ========== ONE ROUND ==========
+// Books every flight at slot 0; returns the booking time in ms and
+// clears ordered if a flight is scheduled behind a less urgent one
+double bookRound(FlightHandle handles[], int priorities[], int order[], bool &ordered)
+{
+    RunwayScheduler scheduler;
+
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    for (int i = 0; i < BENCH_FLIGHTS; i++)
+    {
+        scheduler.book(handles[i], BENCH_AIRPORT, priorities[i], 0);
+    }
+    double ms = millisecondsSince(start);
+
+    if (scheduler.getBookedCount() != BENCH_FLIGHTS)
+    {
+        ordered = false;
+    }
+
+    // Booking index per leaf, in schedule order
+    for (int i = 0; i < BENCH_FLIGHTS; i++)
+    {
+        order[i] = -1;
+    }
+    for (int i = 0; i < BENCH_FLIGHTS; i++)
+    {
+        int slot = scheduler.getSlot(handles[i]);
+        int runway = scheduler.getRunway(handles[i]);
+        if (slot < 0 || runway < 0)
+        {
+            ordered = false;
+            continue;
+        }
+        order[slot * DEFAULT_RUNWAYS + runway] = i;
+    }
+
+    for (int leaf = 1; leaf < BENCH_FLIGHTS; leaf++)
+    {
+        int before = order[leaf - 1];
+        int after = order[leaf];
+        if (before == -1 || after == -1)
+        {
+            ordered = false;
+            continue;
+        }
+        if (priorities[before] > priorities[after])
+        {
+            ordered = false;
+        }
+    }
+
+    return ms;
+}
+
+// ========== MAIN ==========
+int main()
+{
+    logger().setLevel(LEVEL_WARNING);
+
+    cout << "Runway scheduler\n\n";
+    bool cascade = checkCascade();
+
+    FlightHandle *handles = new FlightHandle[BENCH_FLIGHTS];
+    int *priorities = new int[BENCH_FLIGHTS];
+    int *order = new int[BENCH_FLIGHTS];
+
+    // Mostly normal traffic with some low-fuel, low and critical flights
+    const int mix[16] = {3, 3, 3, 3, 3, 3, 3, 3, 3, 2, 2, 2, 4, 4, 4, 1};
+    char buffer[32];
+    unsigned int seed = 12345;
+    for (int i = 0; i < BENCH_FLIGHTS; i++)
+    {
+        sprintf(buffer, "RS%06d", i);
+        handles[i] = flightIDs().intern(buffer);
+
+        seed = seed * 1103515245 + 12345;
+        priorities[i] = mix[(seed >> 16) % 16];
+    }
+
+    bool ordered = true;
+    double totalMs = 0;
+    for (int round = 0; round < BENCH_ROUNDS; round++)
+    {
+        totalMs += bookRound(handles, priorities, order, ordered);
+    }
+
+    cout << "  " << BENCH_FLIGHTS << " bookings at one airport" << fixed << setprecision(2)
+         << " | " << totalMs / BENCH_ROUNDS << " ms (average of " << BENCH_ROUNDS << " rounds)"
+         << " | " << (ordered ? "in order" : "OUT OF ORDER") << "\n";
+    cout.unsetf(ios::fixed);
+
+    delete[] handles;
+    delete[] priorities;
+    delete[] order;
+
+    logger().flush();
+    return cascade && ordered ? 0 : 1;
+}
@@ -7,8 +7,14 @@
 #include "Radar.h"
 #include "FlightManager.h"
 #include "HashTable.h"
-#include "MinHeap.h"
+#include "AirportLandingQueues.h"
 #include "AVLTree.h"
+#include "Snapshot.h"
+#include "Journal.h"
+#include "ReplayEngine.h"
+#include "ChangeFeed.h"
+#include "Logger.h"
+#include "ScheduleImporter.h"
 
 using namespace std;
 
@@ -17,8 +23,12 @@ Graph airspace;
 Radar radar;
 FlightManager flightMgr;
 HashTable registry;
-MinHeap landingQueue;
+AirportLandingQueues landingQueues; // one per airport, type chosen in main()
 AVLTree flightLog;
+Snapshot snapshot(&airspace, &radar, &flightMgr, &registry, &landingQueues, &flightLog);
+Journal journal;
+ChangeFeed registryFeed;
+unsigned long long changeCursor = 0; // operator's place in the registry feed
 
 // ========== FUNCTION PROTOTYPES ==========
 void clearScreen();
@@ -61,6 +71,7 @@ void displayWelcome()
     cout << Color::GREEN << "[OK] Flight logs system ready\n\n"
          << Color::RESET;
 
+    logger().flush();
     cout << Color::YELLOW << "Press ENTER to continue..." << Color::RESET;
     cin.ignore();
 }
@@ -68,6 +79,9 @@ void displayWelcome()
 // ========== CLEAR SCREEN ==========
 void clearScreen()
 {
+    // Queued log messages belong to the screen being left
+    logger().flush();
+
 #ifdef _WIN32
     system("cls");
 #else
@@ -105,29 +119,8 @@ void initializeAirspace()
     cout << Color::BOLD << Color::YELLOW << "\n[SYSTEM] Initializing Airspace...\n"
          << Color::RESET;
 
-    // Add airports with grid coordinates (0-29, 0-19)
-    airspace.addNode(1, "JFK", 5, 2, AIRPORT);
-    airspace.addNode(2, "LHR", 25, 5, AIRPORT);
-    airspace.addNode(3, "CDG", 15, 8, AIRPORT);
-    airspace.addNode(4, "DXB", 28, 12, AIRPORT);
-
-    // Add waypoints with grid coordinates
-    airspace.addNode(5, "W1", 10, 3, WAYPOINT);
-    airspace.addNode(6, "W2", 20, 7, WAYPOINT);
-    airspace.addNode(7, "W3", 5, 10, WAYPOINT);
-    airspace.addNode(8, "W4", 23, 10, WAYPOINT);
-
-    // Add edges (flight corridors) with integer weights
-    airspace.addEdge(1, 5, 50);  // JFK to W1
-    airspace.addEdge(5, 2, 100); // W1 to LHR
-    airspace.addEdge(1, 6, 80);  // JFK to W2
-    airspace.addEdge(6, 3, 75);  // W2 to CDG
-    airspace.addEdge(2, 6, 90);  // LHR to W2
-    airspace.addEdge(6, 4, 120); // W2 to DXB
-    airspace.addEdge(3, 7, 110); // CDG to W3
-    airspace.addEdge(7, 4, 130); // W3 to DXB
-    airspace.addEdge(3, 8, 100); // CDG to W4
-    airspace.addEdge(8, 4, 85);  // W4 to DXB
+    // Add default airports, waypoints and flight corridors
+    airspace.loadDefaultAirspace();
 
     // Set graph reference for flight manager
     flightMgr.setGraphReference(&airspace);
@@ -135,6 +128,42 @@ void initializeAirspace()
     // Set registry reference for flight manager
     flightMgr.setRegistryReference(&registry);
 
+    // Status/airport/model queries walk only the matching aircraft
+    registry.enableIndexes();
+
+    // Approaching flights are sequenced through their airport's landing queue
+    flightMgr.setLandingQueueReference(&landingQueues);
+
+    logger().flush();
+
+    // Journal every change made after the default airspace is built,
+    // then bring back whatever the previous session left behind
+    journal.setReferences(&airspace, &flightMgr, &registry, &snapshot);
+    if (journal.open("atc_journal.bin", "atc_checkpoint.bin"))
+    {
+        airspace.setJournalReference(&journal);
+        flightMgr.setJournalReference(&journal);
+        registry.setJournalReference(&journal);
+        journal.openArchive("atc_events.bin");
+        if (!journal.recover())
+        {
+            // Changes made now would be journaled on top of the wrong state
+            airspace.setJournalReference(NULL);
+            flightMgr.setJournalReference(NULL);
+            registry.setJournalReference(NULL);
+            cout << Color::RED << "[ERROR]" << Color::RESET << " Recovery failed - journal left as it was, changes will not be recoverable\n";
+        }
+    }
+    else
+    {
+        cout << Color::RED << "[ERROR]" << Color::RESET << " Could not open journal - changes will not be recoverable\n";
+    }
+
+    // Registry changes from here on are published; the operator's view
+    // starts with this session
+    registry.setChangeFeed(&registryFeed);
+    changeCursor = registryFeed.tail();
+
     cout << Color::GREEN << "[SUCCESS] Airspace initialized with 4 airports and 4 waypoints\n"
          << Color::RESET;
     cout << Color::GREEN << "[SUCCESS] Flight corridors established\n"
@@ -176,7 +205,7 @@ void updateRadarWithFlights()
             Node *node = airspace.getNode(f->currentNodeID);
             if (node != NULL)
             {
-                radar.placePlane(node->x, node->y, f->flightID, true);
+                radar.placePlane(node->x, node->y, flightIDs().getName(f->flightID), true);
             }
         }
     }
@@ -209,9 +238,9 @@ void displayAirspaceVisualizer()
                  << Color::RESET << " | Type: " << Color::YELLOW << type
                  << Color::RESET << " | Pos: (" << node->x << ", " << node->y << ")";
 
-            if (node->occupiedBy != "")
+            if (node->occupiedBy != NO_FLIGHT)
             {
-                cout << " | " << Color::RED << "OCCUPIED by " << node->occupiedBy << Color::RESET;
+                cout << " | " << Color::RED << "OCCUPIED by " << flightIDs().getName(node->occupiedBy) << Color::RESET;
             }
             cout << "\n";
         }
@@ -221,6 +250,7 @@ void displayAirspaceVisualizer()
          << "+------------------------------------------+\n"
          << Color::RESET << endl;
 
+    logger().flush();
     cout << Color::YELLOW << "Press ENTER to return to menu..." << Color::RESET;
     cin.get();
 }
@@ -243,12 +273,16 @@ void flightControlMenu()
     cout << "  | " << Color::RESET << Color::GREEN << "4. Update Fuel Level" << Color::RESET << Color::BOLD << "                          |\n";
     cout << "  | " << Color::RESET << Color::GREEN << "5. View Active Flights" << Color::RESET << Color::BOLD << "                        |\n";
     cout << "  | " << Color::RESET << Color::GREEN << "6. Land Aircraft" << Color::RESET << Color::BOLD << "                              |\n";
-    cout << "  | " << Color::RESET << Color::RED << "7. Return to Main Menu" << Color::RESET << Color::BOLD << "                        |\n";
+    cout << "  | " << Color::RESET << Color::GREEN << "7. Import Schedule (CSV)" << Color::RESET << Color::BOLD << "                      |\n";
+    cout << "  | " << Color::RESET << Color::GREEN << "8. Run Simulation Tick" << Color::RESET << Color::BOLD << "                        |\n";
+    cout << "  | " << Color::RESET << Color::GREEN << "9. Divert Flight" << Color::RESET << Color::BOLD << "                              |\n";
+    cout << "  | " << Color::RESET << Color::GREEN << "10. View Landing Sequence" << Color::RESET << Color::BOLD << "                     |\n";
+    cout << "  | " << Color::RESET << Color::RED << "11. Return to Main Menu" << Color::RESET << Color::BOLD << "                       |\n";
     cout << "  +-----------------------------------------------+\n";
     cout << Color::RESET << endl;
 
     int choice;
-    cout << Color::CYAN << "Enter your choice (1-7): " << Color::RESET;
+    cout << Color::CYAN << "Enter your choice (1-11): " << Color::RESET;
     cin >> choice;
     cin.ignore();
 
@@ -340,6 +374,7 @@ void flightControlMenu()
     case 5:
     {
         flightMgr.displayAllActiveFlights();
+        logger().flush();
         cout << Color::YELLOW << "Press ENTER to return..." << Color::RESET;
         cin.get();
         break;
@@ -348,6 +383,8 @@ void flightControlMenu()
     {
         string flightID;
 
+        // Manual override: lands an approaching flight now, giving up its
+        // place in the landing queue or its runway slot
         cout << Color::GREEN << "\n[LAND AIRCRAFT]\n"
              << Color::RESET;
         cout << "  " << Color::YELLOW << "Example Flight ID: PK-786, BA-205, EK-156" << Color::RESET << "\n";
@@ -358,12 +395,76 @@ void flightControlMenu()
         break;
     }
     case 7:
+    {
+        string filename;
+
+        cout << Color::GREEN << "\n[IMPORT SCHEDULE]\n"
+             << Color::RESET;
+        cout << "  " << Color::YELLOW << "Columns: Flight ID, Origin, Destination, Priority (1-4), Model" << Color::RESET << "\n";
+        cout << "  Enter CSV File Name: ";
+        getline(cin, filename);
+
+        ScheduleImporter importer(&airspace, &flightMgr);
+        importer.run(filename);
+        break;
+    }
+    case 8:
+    {
+        cout << Color::CYAN << "\n[SIMULATION TICK]\n"
+             << Color::RESET;
+        // Apply queued landing requests before the tick sequences landings
+        flightMgr.sequenceLandingRequests();
+        flightMgr.tick();
+        break;
+    }
+    case 9:
+    {
+        string flightID, destNodeName;
+
+        cout << Color::YELLOW << "\n[DIVERT FLIGHT]\n"
+             << Color::RESET;
+        cout << "  " << Color::YELLOW << "Example Flight ID: PK-786, BA-205, EK-156" << Color::RESET << "\n";
+        cout << "  Enter Flight ID: ";
+        getline(cin, flightID);
+
+        cout << "  " << Color::YELLOW << "Available Airports: JFK, LHR, CDG, DXB" << Color::RESET << "\n";
+        cout << "  Enter New Destination Airport (e.g., CDG): ";
+        getline(cin, destNodeName);
+
+        int destNode = airspace.getNodeID(destNodeName);
+        if (destNode != -1)
+        {
+            flightMgr.divertFlight(flightID, destNode);
+        }
+        else
+        {
+            cout << Color::RED << "[ERROR]" << Color::RESET << " Invalid airport name!" << endl;
+        }
+        break;
+    }
+    case 10:
+    {
+        // Landings are released by the sequencer on each simulation tick
+        landingQueues.displayQueues(&airspace);
+        flightMgr.displayRunwaySchedule();
+        logger().flush();
+        cout << Color::YELLOW << "Press ENTER to return..." << Color::RESET;
+        cin.get();
+        break;
+    }
+    case 11:
         break;
     default:
         cout << Color::RED << "\n[ERROR] Invalid choice!\n"
              << Color::RESET;
     }
+
+    // Group commit: everything this command changed is durable before
+    // the operator is prompted again
+    journal.commit();
+
     cin.ignore();
+    logger().flush();
     cout << Color::YELLOW << "\nPress ENTER to return..." << Color::RESET;
     cin.get();
 }
@@ -383,12 +484,15 @@ void searchAndReportingMenu()
     cout << "  | " << Color::RESET << Color::GREEN << "1. Search Flight" << Color::RESET << Color::BOLD << "                              |\n";
     cout << "  | " << Color::RESET << Color::GREEN << "2. Print Flight Log" << Color::RESET << Color::BOLD << "                           |\n";
     cout << "  | " << Color::RESET << Color::GREEN << "3. Find Safe Route" << Color::RESET << Color::BOLD << "                            |\n";
-    cout << "  | " << Color::RESET << Color::RED << "4. Return to Main Menu" << Color::RESET << Color::BOLD << "                        |\n";
+    cout << "  | " << Color::RESET << Color::GREEN << "4. Conflict Forecast" << Color::RESET << Color::BOLD << "                          |\n";
+    cout << "  | " << Color::RESET << Color::GREEN << "5. Holding Queues" << Color::RESET << Color::BOLD << "                             |\n";
+    cout << "  | " << Color::RESET << Color::GREEN << "6. Registry Query" << Color::RESET << Color::BOLD << "                             |\n";
+    cout << "  | " << Color::RESET << Color::RED << "7. Return to Main Menu" << Color::RESET << Color::BOLD << "                        |\n";
     cout << "  +-----------------------------------------------+\n";
     cout << Color::RESET << endl;
 
     int choice;
-    cout << Color::CYAN << "Enter your choice (1-4): " << Color::RESET;
+    cout << Color::CYAN << "Enter your choice (1-7): " << Color::RESET;
     cin >> choice;
     cin.ignore();
 
@@ -432,12 +536,49 @@ void searchAndReportingMenu()
         break;
     }
     case 4:
+        flightMgr.displayConflictForecast();
+        break;
+    case 5:
+        flightMgr.displayHoldingQueues();
+        break;
+    case 6:
+    {
+        int field;
+        string value, status;
+        cout << Color::GREEN << "\n[REGISTRY QUERY]\n"
+             << Color::RESET;
+        cout << "  Search by: 1=Status | 2=Origin | 3=Destination | 4=Model\n";
+        cout << "  Enter choice (1-4): ";
+        cin >> field;
+        cin.ignore();
+        if (field < 1 || field > REGISTRY_FIELDS)
+        {
+            cout << Color::RED << "\n[ERROR] Invalid field!\n"
+                 << Color::RESET;
+            break;
+        }
+        cout << "  " << Color::YELLOW << "Statuses: FLYING, HOLDING, APPROACHING, LANDED, EMERGENCY" << Color::RESET << "\n";
+        cout << "  Enter value (e.g., DXB, FLYING): ";
+        getline(cin, value);
+        if (field != 1)
+        {
+            cout << "  Also require status (ENTER for any): ";
+            getline(cin, status);
+        }
+        registry.displayMatching(static_cast<RegistryField>(field - 1), value, FIELD_STATUS, status);
+        break;
+    }
+    case 7:
         return;
     default:
         cout << Color::RED << "\n[ERROR] Invalid choice!\n"
              << Color::RESET;
     }
 
+    // Group commit: everything this command changed
+    journal.commit();
+
+    logger().flush();
     cout << Color::YELLOW << "\nPress ENTER to return..." << Color::RESET;
     cin.get();
 }
@@ -460,12 +601,14 @@ void systemMenu()
     cout << "  | " << Color::RESET << Color::GREEN << "4. Save System Data" << Color::RESET << Color::BOLD << "                           |\n";
     cout << "  | " << Color::RESET << Color::GREEN << "5. Load System Data" << Color::RESET << Color::BOLD << "                           |\n";
     cout << "  | " << Color::RESET << Color::GREEN << "6. System Status" << Color::RESET << Color::BOLD << "                              |\n";
-    cout << "  | " << Color::RESET << Color::RED << "7. Return to Main Menu" << Color::RESET << Color::BOLD << "                        |\n";
+    cout << "  | " << Color::RESET << Color::GREEN << "7. Replay Event Log" << Color::RESET << Color::BOLD << "                           |\n";
+    cout << "  | " << Color::RESET << Color::GREEN << "8. Registry Changes" << Color::RESET << Color::BOLD << "                           |\n";
+    cout << "  | " << Color::RESET << Color::RED << "9. Return to Main Menu" << Color::RESET << Color::BOLD << "                        |\n";
     cout << "  +-----------------------------------------------+\n";
     cout << Color::RESET << endl;
 
     int choice;
-    cout << Color::CYAN << "Enter your choice (1-7): " << Color::RESET;
+    cout << Color::CYAN << "Enter your choice (1-9): " << Color::RESET;
     cin >> choice;
     cin.ignore(); // Clear newline from buffer
 
@@ -479,7 +622,7 @@ void systemMenu()
 
         cout << Color::CYAN << "\n[ADD NODE]\n"
              << Color::RESET;
-        cout << "  Enter Node ID (unique number): ";
+        cout << "  Enter Node ID (unique, 0-" << MAX_NODES - 1 << "): ";
         cin >> id;
         cin.ignore();
 
@@ -527,25 +670,48 @@ void systemMenu()
         break;
     }
     case 4:
-        flightMgr.saveToFile("atc_data.txt");
+        snapshot.save("atc_snapshot.bin");
         break;
     case 5:
-        flightMgr.loadFromFile("atc_data.txt");
+        // Loaded state did not come from the journal, so checkpoint it
+        if (snapshot.load("atc_snapshot.bin"))
+        {
+            journal.markExternalState();
+            journal.checkpoint();
+        }
         break;
     case 6:
         cout << Color::CYAN << "\n[INFO] All systems operational\n"
              << Color::RESET;
         cout << "  Active Flights: " << flightMgr.getTotalFlights() << endl;
+        cout << "  Holding Flights: " << flightMgr.getHoldingFlights() << endl;
+        cout << "  Pending Landing Requests: " << flightMgr.getPendingLandingRequests() << endl;
         cout << "  Total Airports: 4" << endl;
         cout << "  Total Waypoints: 4" << endl;
+        registry.displayStats();
         break;
     case 7:
+    {
+        // Flush pending events so the replay sees everything
+        journal.commit();
+        ReplayEngine replayer;
+        replayer.run("atc_events.bin");
+        break;
+    }
+    case 8:
+        registryFeed.displayChanges(changeCursor);
+        break;
+    case 9:
         return;
     default:
         cout << Color::RED << "\n[ERROR] Invalid choice!\n"
              << Color::RESET;
     }
 
+    // Group commit: everything this command changed
+    journal.commit();
+
+    logger().flush();
     cout << Color::YELLOW << "\nPress ENTER to return..." << Color::RESET;
     cin.get();
 }
@@ -562,9 +728,42 @@ void displayFooter()
 }
 
 // ========== MAIN PROGRAM ==========
-int main()
+int main(int argc, char *argv[])
 {
     int choice;
+    bool bucketQueue = false;
+
+    // Console logging: --quiet or --log-level debug|info|warning|error|quiet
+    // Landing queue: --landing-queue heap|buckets (default heap)
+    for (int i = 1; i < argc; i++)
+    {
+        string arg = argv[i];
+        LogLevel level;
+
+        if (arg == "--quiet")
+        {
+            logger().setLevel(LEVEL_QUIET);
+        }
+        else if (arg == "--log-level" && i + 1 < argc && parseLogLevel(argv[i + 1], level))
+        {
+            logger().setLevel(level);
+            i++;
+        }
+        else if (arg == "--landing-queue" && i + 1 < argc &&
+                 (string(argv[i + 1]) == "heap" || string(argv[i + 1]) == "buckets"))
+        {
+            bucketQueue = string(argv[i + 1]) == "buckets";
+            i++;
+        }
+        else
+        {
+            cout << Color::RED << "[ERROR]" << Color::RESET << " Unknown option: " << arg << endl;
+            return 1;
+        }
+    }
+
+    // Every airport's queue is created on its first approach
+    landingQueues.setKind(bucketQueue ? QUEUE_BUCKETS : QUEUE_HEAP);
 
     // Display welcome screen
     displayWelcome();
@@ -572,6 +771,7 @@ int main()
     // Initialize airspace
     initializeAirspace();
 
+    logger().flush();
     cout << Color::YELLOW << "Press ENTER to start..." << Color::RESET;
     cin.ignore();
 
@@ -604,21 +804,27 @@ int main()
             cout << "+==============================================================+\n";
             cout << Color::RESET << endl;
             registry.displayAllAircraft();
+            logger().flush();
             cout << Color::YELLOW << "Press ENTER to return to menu..." << Color::RESET;
             cin.get();
             break;
         case 6:
             clearScreen();
             displayFooter();
+            journal.commit();
             cout << Color::GREEN << "Program terminated successfully.\n"
                  << Color::RESET;
             return 0;
         default:
             cout << Color::RED << "\n[ERROR] Invalid choice! Please try again.\n"
                  << Color::RESET;
+            logger().flush();
             cout << Color::YELLOW << "Press ENTER to continue..." << Color::RESET;
             cin.ignore();
         }
+
+        // Submenus commit before their own prompts; this catches the rest
+        journal.commit();
     }
 
     return 0;